@@ -0,0 +1,3 @@
+int Feedback (Tcl_Interp *interp, int argc, char* argv []);
+
+
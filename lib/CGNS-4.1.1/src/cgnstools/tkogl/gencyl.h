@@ -0,0 +1,3 @@
+int GenericCylinder _ANSI_ARGS_((Tcl_Interp *interp, int argc, char* argv []));
+
+
@@ -0,0 +1,3 @@
+int GetGlVal (Tcl_Interp *interp, int argc, char* argv []);
+
+
@@ -0,0 +1,3 @@
+int glPhoto _ANSI_ARGS_((Tcl_Interp *interp, int argc, char* argv []));
+
+
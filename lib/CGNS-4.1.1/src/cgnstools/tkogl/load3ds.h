@@ -0,0 +1,5 @@
+int glLoad3DStudio _ANSI_ARGS_ ((Tcl_Interp *interp,
+				 int argc,
+				 char ** argv));
+
+
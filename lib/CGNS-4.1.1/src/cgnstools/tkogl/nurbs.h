@@ -0,0 +1,3 @@
+int NurbsSurface (Tcl_Interp *interp, int argc, char* argv []);
+
+
@@ -0,0 +1,3 @@
+int Quadric (Tcl_Interp *interp, int argc, char* argv []);
+
+
@@ -0,0 +1,3 @@
+int StrokeFontExt (Tcl_Interp *interp, int argc, char* argv []);
+
+
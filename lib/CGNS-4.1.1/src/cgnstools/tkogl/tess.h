@@ -0,0 +1,3 @@
+int Tesselate (Tcl_Interp *interp, int argc, char* argv []);
+
+
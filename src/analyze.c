@@ -286,6 +286,18 @@ void initAnalyze(void)
 	}
 }
 
+/**
+ * \brief Reconstruct the pressure at the Gaussian point of a wall side
+ * \param[in] aSide A pointer to the side
+ * \return The pressure at the side
+ */
+double sidePressure(side_t *aSide)
+{
+	elem_t *aElem = aSide->elem;
+	return aElem->pVar[P] + aSide->GP[X] * aElem->u_x[P]
+		+ aSide->GP[Y] * aElem->u_y[P];
+}
+
 /**
  * \brief Calculate CL and CD around the specified wall
  */
@@ -311,11 +323,11 @@ void calcCoef(void)
 	fprintf(cp1File, "x, y, phi, CP_pressureSide\n");
 	sidePtr_t *aSidePtr = wing.firstPressureSide;
 	while (aSidePtr) {
-		double p0 = aSidePtr->side->pVar[P];
+		double p0 = sidePressure(aSidePtr->side);
 		double n[NDIM];
 		n[X]  = aSidePtr->side->n[X];
 		n[Y]  = aSidePtr->side->n[Y];
-		double len = aSidePtr->side->len;
+		double len = sideData.len[aSidePtr->side->id];
 		cl += n[Y] * p0 * len;
 		cd += n[X] * p0 * len;
 		double cp = (p0 - pInf) * qInfQ;
@@ -341,11 +353,11 @@ void calcCoef(void)
 	fprintf(cp2File, "x, y, phi, CP_suctionSide\n");
 	aSidePtr = wing.firstSuctionSide;
 	while (aSidePtr) {
-		double p0 = aSidePtr->side->pVar[P];
+		double p0 = sidePressure(aSidePtr->side);
 		double n[NDIM];
 		n[X]  = aSidePtr->side->n[X];
 		n[Y]  = aSidePtr->side->n[Y];
-		double len = aSidePtr->side->len;
+		double len = sideData.len[aSidePtr->side->id];
 		cl += n[Y] * p0 * len;
 		cd += n[X] * p0 * len;
 		double cp = (p0 - pInf) * qInfQ;
@@ -389,14 +401,15 @@ void calcCoef(void)
 /**
  * \brief Evaluation of recording points
  * \param[in] time Calculation time at output
+ * \param[in] dt Global time step
  */
-void evalRecordPoints(double time)
+void evalRecordPoints(double time, double dt)
 {
 	for (long iPt = 0; iPt < recordPoint.nPoints; ++iPt) {
 		elem_t *aElem = recordPoint.elem[iPt];
 		fprintf(recordPoint.ioFile[iPt],
 			"%20.12f,%20.12f,%20.12f,%20.12f,%20.12f\n",
-			time + aElem->dt, aElem->pVar[RHO], aElem->pVar[VX],
+			time + dt, aElem->pVar[RHO], aElem->pVar[VX],
 			aElem->pVar[VY], aElem->pVar[P]);
 	}
 }
@@ -404,15 +417,16 @@ void evalRecordPoints(double time)
 /**
  * \brief Compute aerodynamic coefficients and extract values at record points
  * \param[in] time Calculation time at output
+ * \param[in] dt Global time step
  * \param[in] iter Iteration count at output
  * \param[in,out] resIter The residual vector containing the CL and CD
  *	residuals at 4th and 5th index position
  */
-void analyze(double time, long iter, double resIter[NVAR + 2])
+void analyze(double time, double dt, long iter, double resIter[NVAR + 2])
 {
 	/* record points */
 	if (recordPoint.nPoints > 0) {
-		evalRecordPoints(time);
+		evalRecordPoints(time, dt);
 	}
 
 	/* aerodynamic coefficients */
@@ -422,16 +436,16 @@ void analyze(double time, long iter, double resIter[NVAR + 2])
 
 		calcCoef();
 
-		resIter[4] = fabs(resIter[4] - wing.cl) / firstElem->dt;
-		resIter[5] = fabs(resIter[5] - wing.cd) / firstElem->dt;
+		resIter[4] = fabs(resIter[4] - wing.cl) / dt;
+		resIter[5] = fabs(resIter[5] - wing.cd) / dt;
 
 		fprintf(resFile, "%7ld, %13.8f, %15.8e, %15.10f, %15.10f\n",
-			iter, time + firstElem->dt, resIter[abortVariable],
+			iter, time + dt, resIter[abortVariable],
 			wing.cl, wing.cd);
 	} else {
 		if (isStationary) {
 			fprintf(resFile, "%7ld, %13.8f, %15.8e, %15.8e, %15.8e, %15.8e\n",
-				iter, time + firstElem->dt, resIter[RHO],
+				iter, time + dt, resIter[RHO],
 				resIter[VX], resIter[VY], resIter[E]);
 		}
 	}
@@ -15,6 +15,7 @@ typedef struct boundary_t boundary_t;
 
 #include "main.h"
 #include "mesh.h"
+#include "dualNumber.h"
 
 /**
  * \brief Structure that holds the information of a boundary condition
@@ -50,10 +51,12 @@ extern int nBC;
 extern bool isPeriodic;
 
 void initBoundary(void);
-void setBCatSides(double time);
 void setBCatBarys(double time);
 void boundary(side_t *aSide, double time, double int_pVar[NVAR],
 		double ghost_pVar[NVAR], double x[NDIM]);
+void setBCatBarysDual(double time);
+void boundaryDual(side_t *aSide, double time, dual_t int_pVar[NVAR],
+		dual_t ghost_pVar[NVAR], double x[NDIM]);
 void freeBoundary(void);
 
 #endif
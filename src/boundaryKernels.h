@@ -0,0 +1,191 @@
+/** \file
+ *
+ * \brief Boundary condition kernels, compiled for double values and for dual
+ *	numbers, see scalar.h
+ *
+ * \author hhh
+ * \date Sun 18 Oct 2026 06:41:09 PM CEST
+ */
+
+/**
+ * \brief Set boundary condition value at x
+ * \param[in] aSide Pinter to a boundary side
+ * \param[in] time Computation time at calculation
+ * \param[in] int_pVar Internal cell primitive variables state
+ * \param[out] ghost_pVar Ghost cell primitive variables state
+ * \param[in] x Barycenter coordinates of the ghost cell
+ */
+void NAME(boundary)(side_t *aSide, double time, real int_pVar[NVAR],
+		real ghost_pVar[NVAR], double x[NDIM])
+{
+	/* extract normal vector */
+	double n[NDIM];
+	n[X] = aSide->connection->n[X];
+	n[Y] = aSide->connection->n[Y];
+
+	/* determine type of boundary condition */
+	switch (aSide->BC->BCtype) {
+	case SLIPWALL: {
+		real VXloc[NDIM], VYloc[NDIM];
+		/* rotate into local coordinate system */
+		VXloc[X] =   n[X] * int_pVar[VX] + n[Y] * int_pVar[VY];
+		VYloc[X] = - n[Y] * int_pVar[VX] + n[X] * int_pVar[VY];
+
+		/* mirror VX and extrapolate VY */
+		VXloc[Y] = - VXloc[X];
+		VYloc[Y] =   VYloc[X];
+
+		/* backrotate into global coordinate system */
+		ghost_pVar[VX] = n[X] * VXloc[Y] - n[Y] * VYloc[Y];
+		ghost_pVar[VY] = n[Y] * VXloc[Y] + n[X] * VYloc[Y];
+
+		/* scalar and derived conservative variables */
+		ghost_pVar[RHO] = int_pVar[RHO];
+		ghost_pVar[P]   = int_pVar[P];
+
+		break;
+	}
+	#ifdef navierstokes
+	case WALL: {
+		real VXloc[NDIM], VYloc[NDIM];
+		/* rotate into local coordinate system */
+		VXloc[X] =   n[X] * int_pVar[VX] + n[Y] * int_pVar[VY];
+		VYloc[X] = - n[Y] * int_pVar[VX] + n[X] * int_pVar[VY];
+
+		/* mirror VX and extrapolate VY */
+		VXloc[Y] = - VXloc[X];
+		if (mu > 0.0) {
+			VYloc[Y] = - VYloc[X];
+		} else {
+			VYloc[Y] =   VYloc[X];
+		}
+
+		/* backrotate into global coordinate system */
+		ghost_pVar[VX] = n[X] * VXloc[Y] - n[Y] * VYloc[Y];
+		ghost_pVar[VY] = n[Y] * VXloc[Y] + n[X] * VYloc[Y];
+
+		/* scalar and derived conservative variables */
+		ghost_pVar[RHO] = int_pVar[RHO];
+		ghost_pVar[P]   = int_pVar[P];
+
+		break;
+	}
+	#endif
+	case INFLOW:
+		ghost_pVar[RHO] = aSide->BC->pVar[RHO];
+		ghost_pVar[VX]  = aSide->BC->pVar[VX];
+		ghost_pVar[VY]  = aSide->BC->pVar[VY];
+		ghost_pVar[P]   = aSide->BC->pVar[P];
+
+		break;
+	case OUTFLOW:
+		ghost_pVar[RHO] = int_pVar[RHO];
+		ghost_pVar[VX]  = int_pVar[VX];
+		ghost_pVar[VY]  = int_pVar[VY];
+		ghost_pVar[P]   = int_pVar[P];
+
+		break;
+	case CHARACTERISTIC: {
+		/* compute Eigenvalues of ghost cell */
+		double c = sqrt(gam * aSide->BC->pVar[P] / aSide->BC->pVar[RHO]);
+		double v = n[X] * aSide->BC->pVar[VX] + n[Y] * aSide->BC->pVar[VY];
+
+		/* rotate primitive state into local coordinate system */
+		real int_pVarloc[NVAR], ghost_pVarloc[NVAR];
+		int_pVarloc[RHO] = int_pVar[RHO];
+		int_pVarloc[VX]  =   n[X] * int_pVar[VX] + n[Y] * int_pVar[VY];
+		int_pVarloc[VY]  = - n[Y] * int_pVar[VX] + n[X] * int_pVar[VY];
+		int_pVarloc[P]   = int_pVar[P];
+
+		ghost_pVarloc[RHO] = aSide->BC->pVar[RHO];
+		ghost_pVarloc[VX]  =   n[X] * aSide->BC->pVar[VX] + n[Y] * aSide->BC->pVar[VY];
+		ghost_pVarloc[VY]  = - n[Y] * aSide->BC->pVar[VX] + n[X] * aSide->BC->pVar[VY];
+		ghost_pVarloc[P]   = aSide->BC->pVar[P];
+
+		/* compute conservative variables of both cells */
+		real int_cVar[NVAR], ghost_cVar[NVAR];
+		NAME(primCons)(int_pVarloc, int_cVar);
+		NAME(primCons)(ghost_pVarloc, ghost_cVar);
+
+		/* compute characteristic variables of inner and ghost cell */
+		real int_charVar[3], ghost_charVar[3];
+		NAME(consChar)(int_cVar, int_charVar, int_pVar);
+		NAME(consChar)(ghost_cVar, ghost_charVar, int_pVar);
+
+		/* determine characteristic state at boundary */
+		if (v + c > 0.0) {
+			ghost_charVar[2] = int_charVar[2];
+		}
+		if (v > 0.0) {
+			ghost_charVar[1] = int_charVar[1];
+		}
+		if (v - c > 0.0) {
+			ghost_charVar[0] = int_charVar[0];
+		}
+
+		/* determine the conservative state of the ghost cell */
+		NAME(charCons)(ghost_charVar, ghost_cVar, int_pVar);
+		if (v > 0.0) {
+			ghost_cVar[MY] = int_cVar[MY];
+		}
+
+		/* determine the primitive state of the ghost cell */
+		NAME(consPrim)(ghost_cVar, ghost_pVar);
+
+		/* rotate the primitive state into the global coordinate system */
+		real VXloc = ghost_pVar[VX];
+		real VYloc = ghost_pVar[VY];
+		ghost_pVar[VX] = n[X] * VXloc - n[Y] * VYloc;
+		ghost_pVar[VY] = n[Y] * VXloc + n[X] * VYloc;
+
+		break;
+	}
+	case EXACTSOL: {
+		double pVarExact[NVAR];
+		exactFunc(aSide->BC->exactFunc, x, time, pVarExact);
+
+		ghost_pVar[RHO] = pVarExact[RHO];
+		ghost_pVar[VX]  = pVarExact[VX];
+		ghost_pVar[VY]  = pVarExact[VY];
+		ghost_pVar[P]   = pVarExact[P];
+
+		break;
+	}
+	case PRESSURE_OUT: {
+		real c = SQRT(gam * int_pVar[P] / int_pVar[RHO]);
+		real v = n[X] * int_pVar[VX] + n[Y] * int_pVar[VY];
+
+		real p;
+		if (RE(v / c) < 1.0) {
+			p = aSide->BC->pVar[P];
+		} else {
+			p = int_pVar[P];
+		}
+
+		ghost_pVar[RHO] = int_pVar[RHO] * p / int_pVar[P];
+		ghost_pVar[VX]  = int_pVar[VX];
+		ghost_pVar[VY]  = int_pVar[VY];
+		ghost_pVar[P]   = p;
+
+		break;
+	}
+	}
+}
+
+/**
+ * \brief Set the ghost values at elements
+ * \param[in] time Computation time at calculation
+ */
+void NAME(setBCatBarys)(double time)
+{
+	#pragma omp parallel for
+	for (long iSide = 0; iSide < nBCsides; ++iSide) {
+		side_t *gSide = BCside[iSide];
+		elem_t *gElem = gSide->elem;
+		side_t *aSide = gSide->connection;
+		elem_t *aElem = aSide->elem;
+
+		NAME(boundary)(gSide, time, STATE.pVar[aElem - elemBlock],
+				STATE.pVar[gElem - elemBlock], gElem->bary);
+	}
+}
@@ -0,0 +1,101 @@
+/** \file
+ *
+ * \brief Dual numbers for the exact Jacobian-vector products
+ *
+ * The spatial operator is evaluated with dual numbers, which carry the
+ * derivative in one direction along with the value. They are represented as
+ * complex numbers: the arithmetic of the complex numbers propagates the
+ * imaginary part like a derivative, up to terms in the square of the
+ * imaginary step `DUAL_STEP`, which vanish in double precision. Comparisons,
+ * absolute values, minima and maxima use the real part only.
+ *
+ * \author hhh
+ * \date Sun 18 Oct 2026 06:41:09 PM CEST
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "main.h"
+#include "dualNumber.h"
+#include "mesh.h"
+
+/* complex.h defines I, which memTools.h uses as a parameter name */
+#include <complex.h>
+
+/* extern variables */
+dualData_t dualData;			/**< dual number states of all elements */
+
+/**
+ * \brief Square root of a dual number
+ * \param[in] x Dual number with a positive value
+ * \return The square root
+ */
+dual_t dualSqrt(dual_t x)
+{
+	double s = sqrt(creal(x));
+	return s + I * (0.5 * cimag(x) / s);
+}
+
+/**
+ * \brief Absolute value of a dual number
+ * \param[in] x Dual number
+ * \return The dual number, negated if its value is negative
+ */
+dual_t dualAbs(dual_t x)
+{
+	return ((creal(x) < 0.0) ? - x : x);
+}
+
+/**
+ * \brief Minimum of two dual numbers
+ * \param[in] a First dual number
+ * \param[in] b Second dual number
+ * \return The dual number with the smaller value
+ */
+dual_t dualMin(dual_t a, dual_t b)
+{
+	return ((creal(b) < creal(a)) ? b : a);
+}
+
+/**
+ * \brief Maximum of two dual numbers
+ * \param[in] a First dual number
+ * \param[in] b Second dual number
+ * \return The dual number with the larger value
+ */
+dual_t dualMax(dual_t a, dual_t b)
+{
+	return ((creal(b) > creal(a)) ? b : a);
+}
+
+/**
+ * \brief Allocate the dual number states of the inner and ghost elements
+ *
+ * The gradients stay zero for the first order reconstruction and for the
+ * ghost elements, as for `elemData`.
+ */
+void initDualNumbers(void)
+{
+	long nElemsTotal = elemData.nElems;
+	dualData.pVar = calloc(nElemsTotal, sizeof(dual_t[NVAR]));
+	dualData.u_x = calloc(nElemsTotal, sizeof(dual_t[NVAR]));
+	dualData.u_y = calloc(nElemsTotal, sizeof(dual_t[NVAR]));
+	dualData.u_t = calloc(nElemsTotal, sizeof(dual_t[NVAR]));
+	if (!dualData.pVar || !dualData.u_x || !dualData.u_y || !dualData.u_t) {
+		printf("| ERROR: could not allocate dualData\n");
+		exit(1);
+	}
+}
+
+/**
+ * \brief Free the dual number states
+ */
+void freeDualNumbers(void)
+{
+	free(dualData.pVar);
+	free(dualData.u_x);
+	free(dualData.u_y);
+	free(dualData.u_t);
+}
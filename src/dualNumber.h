@@ -0,0 +1,43 @@
+/** \file
+ *
+ * \author hhh
+ * \date Sun 18 Oct 2026 06:41:09 PM CEST
+ */
+
+#ifndef DUALNUMBER_H
+#define DUALNUMBER_H
+
+#include "main.h"
+
+#define DUAL_STEP 1e-30		/**< imaginary step of the dual numbers */
+
+/**
+ * \brief Dual number, the value is stored in the real part and the derivative
+ *	times `DUAL_STEP` in the imaginary part
+ */
+typedef double _Complex dual_t;
+
+typedef struct dualData_t dualData_t;
+
+/**
+ * \brief Dual number states, gradients and flux balances of all elements,
+ *	indexed like `elemData`
+ */
+struct dualData_t {
+	dual_t (*pVar)[NVAR];		/**< primitive variables */
+	dual_t (*u_x)[NVAR];		/**< x-gradient of primitive variables */
+	dual_t (*u_y)[NVAR];		/**< y-gradient of primitive variables */
+	dual_t (*u_t)[NVAR];		/**< flux balance and time derivative of
+						the conservative variables */
+};
+
+extern dualData_t dualData;
+
+dual_t dualSqrt(dual_t x);
+dual_t dualAbs(dual_t x);
+dual_t dualMin(dual_t a, dual_t b);
+dual_t dualMax(dual_t a, dual_t b);
+void initDualNumbers(void);
+void freeDualNumbers(void);
+
+#endif
@@ -10,101 +10,69 @@
 
 #include "main.h"
 #include "equation.h"
+#include "equationOfState.h"
+
+#define SCALAR_KERNELS "equationOfStateKernels.h"
+#include "scalar.h"
 
 /**
- * \brief Convert primitive variables into conservative variables
+ * \brief Jacobian of the conservative variables with respect to the primitive
+ *	variables
  * \param[in] pVar Primitive variable vector
- * \param[out] cVar Conservative variable vector
+ * \param[out] dUdW The Jacobian dU / dW
  */
-void primCons(const double pVar[NVAR], double cVar[NVAR])
+void primConsJacobian(const double pVar[NVAR], double dUdW[NVAR][NVAR])
 {
-	cVar[RHO] = pVar[RHO];
-	cVar[MX]  = pVar[VX] * pVar[RHO];
-	cVar[MY]  = pVar[VY] * pVar[RHO];
-	cVar[E]   = gam1q * pVar[P]
-		+ 0.5 * (cVar[MX] * pVar[VX] + cVar[MY] * pVar[VY]);
-}
+	double rho = pVar[RHO], vx = pVar[VX], vy = pVar[VY];
 
-/** \brief Convert conservative variables into primitive variables
- *
- * This function is used during reconstruction, therefore it has to be checked
- * if the resulting primitive variables are negative. It that is the case, they
- * are set to zero.
- *
- * \param[in] cVar Conservative variable vector
- * \param[out] pVar Primitive variable vector
- */
-void consPrim(const double cVar[NVAR], double pVar[NVAR])
-{
-	pVar[RHO] = cVar[RHO];
-	pVar[VX]  = cVar[MX] / cVar[RHO];
-	pVar[VY]  = cVar[MY] / cVar[RHO];
-	pVar[P]   = gam1 *
-		(cVar[E] - 0.5 * (cVar[MX] * pVar[VX] + cVar[MY] * pVar[VY]));
+	dUdW[RHO][RHO] = 1.0;
+	dUdW[RHO][VX]  = 0.0;
+	dUdW[RHO][VY]  = 0.0;
+	dUdW[RHO][P]   = 0.0;
 
-	/* check if density or pressure are negative */
-	if (pVar[RHO] < 1e-19) {
-		pVar[RHO] = 1e-10;
-	}
-	if (pVar[P] < 1e-19) {
-		pVar[P] = 1e-10;
-	}
-}
+	dUdW[MX][RHO] = vx;
+	dUdW[MX][VX]  = rho;
+	dUdW[MX][VY]  = 0.0;
+	dUdW[MX][P]   = 0.0;
 
-/**
- * \brief Convert conservative variables to characteristic variables
- * \param[in] cVar Conservative variable vector
- * \param[out] charac Characteristic variable vector
- * \param[in] pVarRef Reference primitive variable vector
- */
-void consChar(double cVar[NVAR], double charac[3], double pVarRef[NVAR])
-{
-	double c = sqrt(gam * pVarRef[P] / pVarRef[RHO]);
-	double u = pVarRef[VX];
-	double H = gam1q * c * c + 0.5 * u * u;
-	double phi = u * u - 2.0 * H;
-	double a1 = 1.0 / (2.0 * c * phi);
-	double a2 = 1.0 / phi;
-	double a3 = u * c;
+	dUdW[MY][RHO] = vy;
+	dUdW[MY][VX]  = 0.0;
+	dUdW[MY][VY]  = rho;
+	dUdW[MY][P]   = 0.0;
 
-	double cVar1D[3] = {cVar[RHO], cVar[VX], cVar[E]};
-	double K[3][3] = {
-		{a1 * u * (phi - a3), -a1 * (phi - 2.0 * a3), -a2},
-		{a2 * (u * u + phi), -2.0 * u * a2, 2.0 * a2},
-		{-a1 * u * (a3 + phi), a1 * (phi + 2.0 * a3), -a2}
-	};
-	for (int i = 0; i < 3; ++i) {
-		charac[i] = 0.0;
-		for (int j = 0; j < 3; ++j) {
-			charac[i] += K[i][j] * cVar1D[j];
-		}
-	}
+	dUdW[E][RHO] = 0.5 * (vx * vx + vy * vy);
+	dUdW[E][VX]  = rho * vx;
+	dUdW[E][VY]  = rho * vy;
+	dUdW[E][P]   = gam1q;
 }
 
 /**
- * \brief Convert characteristic variables to conservative variables
- * \param[in] charac Characteristic variable vector
- * \param[out] cVar Conservative variable vector
- * \param[in] pVarRef Reference primitive variable vector
+ * \brief Jacobian of the primitive variables with respect to the conservative
+ *	variables
+ * \param[in] pVar Primitive variable vector
+ * \param[out] dWdU The Jacobian dW / dU
  */
-void charCons(double charac[3], double cVar[NVAR], double pVarRef[NVAR])
+void consPrimJacobian(const double pVar[NVAR], double dWdU[NVAR][NVAR])
 {
-	double u = pVarRef[VX];
-	double c = sqrt(gam * pVarRef[P] / pVarRef[RHO]);
-	double H = gam1q * c * c + 0.5 * u * u;
-	double K[3][3] = {
-		{1.0, 1.0, 1.0},
-		{u - c, u, u + c},
-		{H - u * c, 0.5 * u * u, H + u * c}
-	};
+	double rhoq = 1.0 / pVar[RHO], vx = pVar[VX], vy = pVar[VY];
+
+	dWdU[RHO][RHO] = 1.0;
+	dWdU[RHO][MX]  = 0.0;
+	dWdU[RHO][MY]  = 0.0;
+	dWdU[RHO][E]   = 0.0;
+
+	dWdU[VX][RHO] = - vx * rhoq;
+	dWdU[VX][MX]  = rhoq;
+	dWdU[VX][MY]  = 0.0;
+	dWdU[VX][E]   = 0.0;
+
+	dWdU[VY][RHO] = - vy * rhoq;
+	dWdU[VY][MX]  = 0.0;
+	dWdU[VY][MY]  = rhoq;
+	dWdU[VY][E]   = 0.0;
 
-	double cVar1D[3] = {0.0};
-	for (int i = 0; i < 3; ++i) {
-		for (int j = 0; j < 3; ++j) {
-			cVar1D[i] += K[i][j] * charac[j];
-		}
-	}
-	cVar[RHO] = cVar1D[0];
-	cVar[MX]  = cVar1D[1];
-	cVar[E]   = cVar1D[2];
+	dWdU[P][RHO] = 0.5 * gam1 * (vx * vx + vy * vy);
+	dWdU[P][MX]  = - gam1 * vx;
+	dWdU[P][MY]  = - gam1 * vy;
+	dWdU[P][E]   = gam1;
 }
@@ -8,10 +8,18 @@
 #define EQUATIONOFSTATE_H
 
 #include "main.h"
+#include "dualNumber.h"
 
 void primCons(const double pVar[NVAR], double cVar[NVAR]);
 void consPrim(const double cVar[NVAR], double pVar[NVAR]);
+void primConsJacobian(const double pVar[NVAR], double dUdW[NVAR][NVAR]);
+void consPrimJacobian(const double pVar[NVAR], double dWdU[NVAR][NVAR]);
 void consChar(double cVar[NVAR], double charac[3], double pVarRef[NVAR]);
 void charCons(double charac[3], double cVar[NVAR], double pVarRef[NVAR]);
 
+void primConsDual(const dual_t pVar[NVAR], dual_t cVar[NVAR]);
+void consPrimDual(const dual_t cVar[NVAR], dual_t pVar[NVAR]);
+void consCharDual(dual_t cVar[NVAR], dual_t charac[3], dual_t pVarRef[NVAR]);
+void charConsDual(dual_t charac[3], dual_t cVar[NVAR], dual_t pVarRef[NVAR]);
+
 #endif
@@ -0,0 +1,106 @@
+/** \file
+ *
+ * \brief Conversion kernels between the different variable types, compiled
+ *	for double values and for dual numbers, see scalar.h
+ *
+ * \author hhh
+ * \date Sun 18 Oct 2026 06:41:09 PM CEST
+ */
+
+/**
+ * \brief Convert primitive variables into conservative variables
+ * \param[in] pVar Primitive variable vector
+ * \param[out] cVar Conservative variable vector
+ */
+void NAME(primCons)(const real pVar[NVAR], real cVar[NVAR])
+{
+	cVar[RHO] = pVar[RHO];
+	cVar[MX]  = pVar[VX] * pVar[RHO];
+	cVar[MY]  = pVar[VY] * pVar[RHO];
+	cVar[E]   = gam1q * pVar[P]
+		+ 0.5 * (cVar[MX] * pVar[VX] + cVar[MY] * pVar[VY]);
+}
+
+/** \brief Convert conservative variables into primitive variables
+ *
+ * This function is used during reconstruction, therefore it has to be checked
+ * if the resulting primitive variables are negative. It that is the case, they
+ * are set to zero.
+ *
+ * \param[in] cVar Conservative variable vector
+ * \param[out] pVar Primitive variable vector
+ */
+void NAME(consPrim)(const real cVar[NVAR], real pVar[NVAR])
+{
+	pVar[RHO] = cVar[RHO];
+	pVar[VX]  = cVar[MX] / cVar[RHO];
+	pVar[VY]  = cVar[MY] / cVar[RHO];
+	pVar[P]   = gam1 *
+		(cVar[E] - 0.5 * (cVar[MX] * pVar[VX] + cVar[MY] * pVar[VY]));
+
+	/* check if density or pressure are negative */
+	if (RE(pVar[RHO]) < 1e-19) {
+		pVar[RHO] = 1e-10;
+	}
+	if (RE(pVar[P]) < 1e-19) {
+		pVar[P] = 1e-10;
+	}
+}
+
+/**
+ * \brief Convert conservative variables to characteristic variables
+ * \param[in] cVar Conservative variable vector
+ * \param[out] charac Characteristic variable vector
+ * \param[in] pVarRef Reference primitive variable vector
+ */
+void NAME(consChar)(real cVar[NVAR], real charac[3], real pVarRef[NVAR])
+{
+	real c = SQRT(gam * pVarRef[P] / pVarRef[RHO]);
+	real u = pVarRef[VX];
+	real H = gam1q * c * c + 0.5 * u * u;
+	real phi = u * u - 2.0 * H;
+	real a1 = 1.0 / (2.0 * c * phi);
+	real a2 = 1.0 / phi;
+	real a3 = u * c;
+
+	real cVar1D[3] = {cVar[RHO], cVar[VX], cVar[E]};
+	real K[3][3] = {
+		{a1 * u * (phi - a3), -a1 * (phi - 2.0 * a3), -a2},
+		{a2 * (u * u + phi), -2.0 * u * a2, 2.0 * a2},
+		{-a1 * u * (a3 + phi), a1 * (phi + 2.0 * a3), -a2}
+	};
+	for (int i = 0; i < 3; ++i) {
+		charac[i] = 0.0;
+		for (int j = 0; j < 3; ++j) {
+			charac[i] += K[i][j] * cVar1D[j];
+		}
+	}
+}
+
+/**
+ * \brief Convert characteristic variables to conservative variables
+ * \param[in] charac Characteristic variable vector
+ * \param[out] cVar Conservative variable vector
+ * \param[in] pVarRef Reference primitive variable vector
+ */
+void NAME(charCons)(real charac[3], real cVar[NVAR], real pVarRef[NVAR])
+{
+	real u = pVarRef[VX];
+	real c = SQRT(gam * pVarRef[P] / pVarRef[RHO]);
+	real H = gam1q * c * c + 0.5 * u * u;
+	real K[3][3] = {
+		{1.0, 1.0, 1.0},
+		{u - c, u, u + c},
+		{H - u * c, 0.5 * u * u, H + u * c}
+	};
+
+	real cVar1D[3] = {0.0};
+	for (int i = 0; i < 3; ++i) {
+		for (int j = 0; j < 3; ++j) {
+			cVar1D[i] += K[i][j] * charac[j];
+		}
+	}
+	cVar[RHO] = cVar1D[0];
+	cVar[MX]  = cVar1D[1];
+	cVar[E]   = cVar1D[2];
+}
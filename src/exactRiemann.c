@@ -9,6 +9,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
+#include <stdbool.h>
 
 #include "equation.h"
 
@@ -16,6 +17,9 @@
 double G[9];				/**< gamma vector */
 double tol = 1e-6;			/**< tolerance for the iteration */
 int nIter = 1000;			/**< maximum number of iterations */
+double qPVRS = 1.0001;			/**< pressure ratio below which the PVRS is used */
+double qExact = 1.01;			/**< pressure ratio above which the star
+					     state is iterated */
 
 /**
  * \brief Helper function for `exactRiemann`
@@ -42,26 +46,10 @@ void preFun(double *f, double *fd, double p, double rhok, double pk, double ck)
 }
 
 /**
- * \brief Calculate the exact solution to the Riemann problem
- * \param[in] rhol Left side density
- * \param[in] rhor Right side density
- * \param[out] rho The resulting density
- * \param[in] ul Left side velocity
- * \param[in] ur Right side velocity
- * \param[out] u Resulting velocity
- * \param[in] pl Left side pressure
- * \param[in] pr Right side pressure
- * \param[out] p Resulting pressure
- * \param[in] al Left side speed of sound
- * \param[in] ar Right side speed of sound
- * \param[in] s	Speed of the discontinuity
+ * \brief Fill the gamma vector
  */
-void exactRiemann(double rhol, double rhor, double *rho,
-		  double ul,   double ur,   double *u,
-		  double pl,   double pr,   double *p,
-		  double al,   double ar,   double s)
+void fillG(void)
 {
-	/* fill G matrix */
 	G[0] = (gam - 1.0) / (2.0 * gam);
 	G[1] = (gam + 1.0) / (2.0 * gam);
 	G[2] = 2.0 * gam / (gam - 1.0);
@@ -71,7 +59,22 @@ void exactRiemann(double rhol, double rhor, double *rho,
 	G[6] = 0.5 * (gam - 1.0);
 	G[7] = 1.0 / gam;
 	G[8] = gam - 1.0;
+}
 
+/**
+ * \brief Abort if the given data generate vacuum
+ * \param[in] rhol Left side density
+ * \param[in] rhor Right side density
+ * \param[in] ul Left side velocity
+ * \param[in] ur Right side velocity
+ * \param[in] pl Left side pressure
+ * \param[in] pr Right side pressure
+ * \param[in] al Left side speed of sound
+ * \param[in] ar Right side speed of sound
+ */
+void checkVacuum(double rhol, double rhor, double ul, double ur,
+		 double pl, double pr, double al, double ar)
+{
 	double du = ur - ul;
 	double duCrit = G[3] * (al + ar) - du;
 	if (duCrit < 0.0) {
@@ -89,30 +92,27 @@ void exactRiemann(double rhol, double rhor, double *rho,
 		printf("| a_l+a_r = %g\n", al + ar);
 		exit(1);
 	}
+}
 
-	/* starting pressure */
-	double qMax = 2.0;
-	double pv = 0.5 * (pl + pr)
-		- 0.125 * (ur - ul) * (rhol + rhor) * (al + ar);
-	double pMin = fmin(pl, pr);
-	double pMax = fmax(pl, pr);
-	double qRat = pMax / pMin;
-	if ((qRat < qMax) && (pMin < pv) && (pv < pMax)) {
-		*p = fmax(tol, pv);
-	} else {
-		if (pv < pMin) {
-			double pnu = al + ar - G[6] * (ur - ul);
-			double pde = al / pow(pl, G[0]) + ar / pow(pr, G[0]);
-			*p = pow(pnu / pde, G[2]);
-		} else {
-			double gel = sqrt((G[4] / rhol) / (G[5] * pl + fmax(tol, pv)));
-			double ger = sqrt((G[4] / rhor) / (G[5] * pr + fmax(tol, pv)));
-			*p = (gel * pl + ger * pr - (ur - ul)) / (gel + ger);
-			*p = fmax(tol, *p);
-		}
-	}
-
-	/* iteration */
+/**
+ * \brief Newton iteration for the pressure in the star region
+ * \param[in] rhol Left side density
+ * \param[in] rhor Right side density
+ * \param[in] ul Left side velocity
+ * \param[in] ur Right side velocity
+ * \param[out] u Velocity in the star region
+ * \param[in] pl Left side pressure
+ * \param[in] pr Right side pressure
+ * \param[in,out] p Initial guess and resulting pressure in the star region
+ * \param[in] al Left side speed of sound
+ * \param[in] ar Right side speed of sound
+ */
+void iterateStarState(double rhol, double rhor,
+		      double ul,   double ur,   double *u,
+		      double pl,   double pr,   double *p,
+		      double al,   double ar)
+{
+	double du = ur - ul;
 	double p0 = *p;
 	double cha = 2.0 * tol;
 	int KK = 0;
@@ -138,11 +138,31 @@ void exactRiemann(double rhol, double rhor, double *rho,
 	}
 
 	*u = 0.5 * (ul + ur + fr - fl);
+}
 
-	double pm = *p;
-	double um = *u;
-
-	/* sample */
+/**
+ * \brief Sample the solution of the Riemann problem from the star state
+ * \param[in] rhol Left side density
+ * \param[in] rhor Right side density
+ * \param[out] rho The resulting density
+ * \param[in] ul Left side velocity
+ * \param[in] ur Right side velocity
+ * \param[out] u Resulting velocity
+ * \param[in] pl Left side pressure
+ * \param[in] pr Right side pressure
+ * \param[out] p Resulting pressure
+ * \param[in] al Left side speed of sound
+ * \param[in] ar Right side speed of sound
+ * \param[in] pm Pressure in the star region
+ * \param[in] um Velocity in the star region
+ * \param[in] s	Speed of the discontinuity
+ */
+void sampleRiemann(double rhol, double rhor, double *rho,
+		   double ul,   double ur,   double *u,
+		   double pl,   double pr,   double *p,
+		   double al,   double ar,
+		   double pm,   double um,   double s)
+{
 	if (s < um) {
 		if (pm < pl) {
 			if (s < ul - al) {
@@ -212,3 +232,133 @@ void exactRiemann(double rhol, double rhor, double *rho,
 		}
 	}
 }
+
+/**
+ * \brief Calculate the exact solution to the Riemann problem
+ * \param[in] rhol Left side density
+ * \param[in] rhor Right side density
+ * \param[out] rho The resulting density
+ * \param[in] ul Left side velocity
+ * \param[in] ur Right side velocity
+ * \param[out] u Resulting velocity
+ * \param[in] pl Left side pressure
+ * \param[in] pr Right side pressure
+ * \param[out] p Resulting pressure
+ * \param[in] al Left side speed of sound
+ * \param[in] ar Right side speed of sound
+ * \param[in] s	Speed of the discontinuity
+ */
+void exactRiemann(double rhol, double rhor, double *rho,
+		  double ul,   double ur,   double *u,
+		  double pl,   double pr,   double *p,
+		  double al,   double ar,   double s)
+{
+	fillG();
+	checkVacuum(rhol, rhor, ul, ur, pl, pr, al, ar);
+
+	/* starting pressure */
+	double qMax = 2.0;
+	double pv = 0.5 * (pl + pr)
+		- 0.125 * (ur - ul) * (rhol + rhor) * (al + ar);
+	double pMin = fmin(pl, pr);
+	double pMax = fmax(pl, pr);
+	double qRat = pMax / pMin;
+	if ((qRat < qMax) && (pMin < pv) && (pv < pMax)) {
+		*p = fmax(tol, pv);
+	} else {
+		if (pv < pMin) {
+			double pnu = al + ar - G[6] * (ur - ul);
+			double pde = al / pow(pl, G[0]) + ar / pow(pr, G[0]);
+			*p = pow(pnu / pde, G[2]);
+		} else {
+			double gel = sqrt((G[4] / rhol) / (G[5] * pl + fmax(tol, pv)));
+			double ger = sqrt((G[4] / rhor) / (G[5] * pr + fmax(tol, pv)));
+			*p = (gel * pl + ger * pr - (ur - ul)) / (gel + ger);
+			*p = fmax(tol, *p);
+		}
+	}
+
+	/* iteration */
+	double um;
+	iterateStarState(rhol, rhor, ul, ur, &um, pl, pr, p, al, ar);
+
+	sampleRiemann(rhol, rhor, rho, ul, ur, u, pl, pr, p, al, ar, *p, um, s);
+}
+
+/**
+ * \brief Calculate the solution to the Riemann problem with an adaptive
+ *	noniterative solver
+ *
+ * The star state is approximated by the primitive variable Riemann solver
+ * (PVRS) for small pressure ratios, otherwise by the two-rarefaction (TRRS) or
+ * two-shock (TSRS) approximation. The TRRS is exact if both waves are
+ * rarefactions. In all other cases, the Newton iteration of the exact solver
+ * is performed if the pressure ratio across the waves exceeds `qExact`,
+ * starting from the approximation. The thresholds are chosen such that the
+ * solution agrees with `exactRiemann` to within the iteration tolerance.
+ *
+ * \param[in] rhol Left side density
+ * \param[in] rhor Right side density
+ * \param[out] rho The resulting density
+ * \param[in] ul Left side velocity
+ * \param[in] ur Right side velocity
+ * \param[out] u Resulting velocity
+ * \param[in] pl Left side pressure
+ * \param[in] pr Right side pressure
+ * \param[out] p Resulting pressure
+ * \param[in] al Left side speed of sound
+ * \param[in] ar Right side speed of sound
+ * \param[in] s	Speed of the discontinuity
+ */
+void adaptiveRiemann(double rhol, double rhor, double *rho,
+		     double ul,   double ur,   double *u,
+		     double pl,   double pr,   double *p,
+		     double al,   double ar,   double s)
+{
+	fillG();
+	checkVacuum(rhol, rhor, ul, ur, pl, pr, al, ar);
+
+	double du = ur - ul;
+	double pMin = fmin(pl, pr);
+	double pMax = fmax(pl, pr);
+	double qRat = pMax / pMin;
+
+	/* primitive variable Riemann solver */
+	double rhoa = 0.25 * (rhol + rhor) * (al + ar);
+	double pv = 0.5 * (pl + pr) - 0.5 * du * rhoa;
+
+	double pm, um;
+	bool exact = false;
+	if ((qRat < qPVRS) && (pMin <= pv) && (pv <= pMax)) {
+		pm = pv;
+		um = 0.5 * (ul + ur) + 0.5 * (pl - pr) / rhoa;
+	} else if (pv < pMin) {
+		/* two-rarefaction Riemann solver, exact if both waves are
+		 * rarefactions */
+		double pql = pow(pl, G[0]);
+		double pqr = pow(pr, G[0]);
+		double pnu = al + ar - G[6] * du;
+		double pde = al / pql + ar / pqr;
+		pm = pow(pnu / pde, G[2]);
+
+		double plr = pql / pqr;
+		um = (plr * ul / al + ur / ar + G[3] * (plr - 1.0))
+			/ (plr / al + 1.0 / ar);
+		exact = (pm <= pMin);
+	} else {
+		/* two-shock Riemann solver */
+		double gel = sqrt((G[4] / rhol) / (G[5] * pl + fmax(tol, pv)));
+		double ger = sqrt((G[4] / rhor) / (G[5] * pr + fmax(tol, pv)));
+		pm = (gel * pl + ger * pr - du) / (gel + ger);
+		pm = fmax(tol, pm);
+		um = 0.5 * (ul + ur) + 0.5 * ((pm - pr) * ger - (pm - pl) * gel);
+	}
+
+	/* exact iteration for strong waves */
+	double qStar = fmax(pMax, pm) / fmin(pMin, pm);
+	if (!exact && (qStar > qExact)) {
+		iterateStarState(rhol, rhor, ul, ur, &um, pl, pr, &pm, al, ar);
+	}
+
+	sampleRiemann(rhol, rhor, rho, ul, ur, u, pl, pr, p, al, ar, pm, um, s);
+}
@@ -11,5 +11,9 @@ void exactRiemann(double rhol, double rhor, double *rho,
 		  double ul,   double ur,   double *u,
 		  double pl,   double pr,   double *p,
 		  double al,   double ar,   double s);
+void adaptiveRiemann(double rhol, double rhor, double *rho,
+		     double ul,   double ur,   double *u,
+		     double pl,   double pr,   double *p,
+		     double al,   double ar,   double s);
 
 #endif
@@ -8,6 +8,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdbool.h>
 #include <math.h>
 
 #include "main.h"
@@ -23,6 +24,23 @@
 /* extern variables */
 int spatialOrder;			/**< the spacial order to be used */
 int fluxFunction;			/**< the flux function to be used */
+void (*fvTimeDerivative)(double time);	/**< the time derivative selected in initFV */
+void (*fvTimeDerivativeDual)(double time);	/**< the time derivative for dual
+						numbers, NULL if the flux function
+						has none */
+long freezeLimiterIter;			/**< iteration after which the limiter
+					is frozen, 0 to disable */
+double freezeLimiterOrders;		/**< orders of magnitude of residual
+					drop after which the limiter is frozen,
+					0 to disable */
+bool isLimiterFrozen;			/**< flag for frozen limiter values */
+
+/* local variables */
+double resFreeze0;			/**< first residual, reference for the
+					residual drop */
+
+#define SCALAR_KERNELS "finiteVolumeKernels.h"
+#include "scalar.h"
 
 /**
  * \brief Initialize the finite volume method
@@ -55,67 +73,90 @@ void initFV(void)
 			printf("| ERROR: Limiter must be either 1 or 2\n");
 			exit(1);
 		}
+
+		freezeLimiterIter = getInt("freezeLimiterIter", "0");
+		freezeLimiterOrders = getDbl("freezeLimiterOrders", "0");
+		if ((freezeLimiterIter > 0) || (freezeLimiterOrders > 0.0)) {
+			printf("| Limiter Freezing: after %ld iterations or a residual drop of %g orders\n",
+					freezeLimiterIter, freezeLimiterOrders);
+		}
 	}
+	isLimiterFrozen = false;
+	resFreeze0 = 0.0;
 
 	for (long iElem = 0; iElem < nElems; ++iElem) {
 		for (int iVar = 0; iVar < NVAR; ++iVar) {
-			elem[iElem]->source[iVar] = 0.0;
+			elemData.source[iElem][iVar] = 0.0;
 		}
 	}
+
+	initFluxCalculation();
+
+	/* select the specialized spatial operator */
+	int iRec = (spatialOrder == 1 ? 0 : limiter);
+	fvTimeDerivative = fvTimeDerivatives[iFlux][iRec];
+	fvTimeDerivativeDual = fvTimeDerivativesDual[iFlux][iRec];
+	switch (iRec) {
+	case 0:
+		spatialReconstruction = spatialReconstruction_firstOrder;
+		break;
+	case BARTHJESPERSEN:
+		spatialReconstruction = spatialReconstruction_barthJespersen;
+		break;
+	case VENKATAKRISHNAN:
+		spatialReconstruction = spatialReconstruction_venkatakrishnan;
+		break;
+	}
 }
 
 /**
- * \brief Perform the spacial operator of the finite volume scheme
+ * \brief Freeze the limiter of a stationary computation once the given
+ *	number of iterations is reached or the residual has dropped by the given
+ *	orders of magnitude
  *
- * First, the local time step is calculated, then spacial gradients inside of
- * the cells are reconstructed. Following that, the boundary conditions at the
- * sides are applied and the numerical flux is calculated, using the specified
- * flux function. Finally, the source term is evaluated and the time derivatives
- * of all the elements are calculated.
+ * A limiter that keeps switching between neighbor values stalls the
+ * convergence. The limiter values of the current state are stored and the
+ * spatial operator switches to the reconstruction with the frozen limiter,
+ * which skips the scan of the neighbor values.
  *
- * \param[in] time Calculation time at which to perform the finite volume differentiation
+ * \param[in] time Calculation time
+ * \param[in] iter Iteration number
+ * \param[in] residual Residual of the abort variable
  */
-void fvTimeDerivative(double time)
+void checkLimiterFreeze(double time, long iter, double residual)
 {
-	/* set dt for boundary condition calculation */
-	#pragma omp parallel for
-	for (long iElem = 0; iElem < nElems; ++iElem) {
-		elem_t *aElem = elem[iElem];
-		aElem->dtLoc = 0.5 * aElem->dt * (timeOrder - 1);
+	if ((spatialOrder == 1) || isLimiterFrozen) {
+		return;
 	}
 
-	spatialReconstruction(time);
-	setBCatSides(time);
-	fluxCalculation();
-
-	if (doCalcSource) {
-		calcSource(time);
+	if (resFreeze0 == 0.0) {
+		resFreeze0 = residual;
 	}
 
-	/* time update of the conservative variables */
-	#pragma omp parallel for
-	for (long iElem = 0; iElem < nElems; ++iElem) {
-		elem_t *aElem = elem[iElem];
-		side_t *aSide = aElem->firstSide;
-
-		aElem->u_t[RHO] = 0.0;
-		aElem->u_t[VX]  = 0.0;
-		aElem->u_t[VY]  = 0.0;
-		aElem->u_t[E]   = 0.0;
-
-		while (aSide) {
-			aElem->u_t[RHO] += aSide->flux[RHO];
-			aElem->u_t[VX]  += aSide->flux[VX];
-			aElem->u_t[VY]  += aSide->flux[VY];
-			aElem->u_t[E]   += aSide->flux[E];
-
-			aSide = aSide->nextElemSide;
-		}
+	bool doFreeze = false;
+	if ((freezeLimiterIter > 0) && (iter >= freezeLimiterIter)) {
+		doFreeze = true;
+	}
+	if ((freezeLimiterOrders > 0.0) && (residual > 0.0)
+			&& (log10(resFreeze0 / residual) >= freezeLimiterOrders)) {
+		doFreeze = true;
+	}
 
-		/* source term contribution */
-		aElem->u_t[RHO] = (aElem->source[RHO] - aElem->u_t[RHO]) * aElem->areaq;
-		aElem->u_t[VX]  = (aElem->source[VX]  - aElem->u_t[VX])  * aElem->areaq;
-		aElem->u_t[VY]  = (aElem->source[VY]  - aElem->u_t[VY])  * aElem->areaq;
-		aElem->u_t[E]   = (aElem->source[E]   - aElem->u_t[E])   * aElem->areaq;
+	if (doFreeze) {
+		freezeLimiter(time);
+		fvTimeDerivative = fvTimeDerivatives[iFlux][FROZEN_LIMITER];
+		fvTimeDerivativeDual = fvTimeDerivativesDual[iFlux][FROZEN_LIMITER];
+		spatialReconstruction = spatialReconstruction_frozenLimiter;
+		isLimiterFrozen = true;
+		printf("| Limiter frozen at iteration %ld\n", iter);
 	}
 }
+
+/**
+ * \brief Free the memory of the finite volume method
+ */
+void freeFV(void)
+{
+	freeFluxCalculation();
+	freeReconstruction();
+}
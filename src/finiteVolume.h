@@ -7,10 +7,18 @@
 #ifndef FINITEVOLUME_H
 #define FINITEVOLUME_H
 
+#include <stdbool.h>
+
 extern int spatialOrder;
 extern int fluxFunction;
+extern void (*fvTimeDerivative)(double time);
+extern void (*fvTimeDerivativeDual)(double time);
+extern long freezeLimiterIter;
+extern double freezeLimiterOrders;
+extern bool isLimiterFrozen;
 
 void initFV(void);
-void fvTimeDerivative(double time);
+void checkLimiterFreeze(double time, long iter, double residual);
+void freeFV(void);
 
 #endif
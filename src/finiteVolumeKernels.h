@@ -0,0 +1,99 @@
+/** \file
+ *
+ * \brief Finite volume time derivative kernels, compiled for double values
+ *	and for dual numbers, see scalar.h
+ *
+ * \author hhh
+ * \date Sun 18 Oct 2026 06:41:09 PM CEST
+ */
+
+/**
+ * \brief Evaluate the source term and compute the time derivatives of all
+ *	elements from the flux balance
+ * \param[in] time Calculation time at which to perform the finite volume differentiation
+ */
+void NAME(elemTimeDerivative)(double time)
+{
+	if (doCalcSource) {
+		calcSource(time);
+	}
+
+	/* time update of the conservative variables */
+	#pragma omp parallel for
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		elem_t *aElem = elem[iElem];
+		real *u_t = STATE.u_t[iElem];
+		double *source = elemData.source[iElem];
+
+		/* source term contribution */
+		u_t[RHO] = (source[RHO] - u_t[RHO]) * aElem->areaq;
+		u_t[VX]  = (source[VX]  - u_t[VX])  * aElem->areaq;
+		u_t[VY]  = (source[VY]  - u_t[VY])  * aElem->areaq;
+		u_t[E]   = (source[E]   - u_t[E])   * aElem->areaq;
+	}
+}
+
+/**
+ * \brief Generate the time derivative for a flux function and reconstruction
+ *
+ * The spatial operator is specialized for every combination of flux function
+ * and reconstruction, the reconstruction and flux calculation are called
+ * directly, so that the dispatch happens once in `initFV` instead of inside
+ * the element and side loops. The residual is evaluated in three sweeps: the
+ * limited gradients per element, the fluxes per face, including the side
+ * states and boundary conditions, which are scattered into the flux balance
+ * of both elements, and the time derivative per element.
+ */
+#define FV_TIME_DERIVATIVE(fluxName, recName) \
+void NAME(fvTimeDerivative_##recName##_##fluxName)(double time) \
+{ \
+	NAME(spatialReconstruction_##recName)(time); \
+	NAME(fluxCalculation_##fluxName)(time); \
+	NAME(elemTimeDerivative)(time); \
+}
+
+#define FV_TIME_DERIVATIVES(ID, name) \
+	FV_TIME_DERIVATIVE(name, firstOrder) \
+	FV_TIME_DERIVATIVE(name, barthJespersen) \
+	FV_TIME_DERIVATIVE(name, venkatakrishnan) \
+	FV_TIME_DERIVATIVE(name, frozenLimiter)
+
+#define FV_TIME_DERIVATIVE_ENTRY(ID, name) \
+	[ID] = { \
+		NAME(fvTimeDerivative_firstOrder_##name), \
+		NAME(fvTimeDerivative_barthJespersen_##name), \
+		NAME(fvTimeDerivative_venkatakrishnan_##name), \
+		NAME(fvTimeDerivative_frozenLimiter_##name) \
+	},
+
+#ifdef DUAL_NUMBERS
+#define SCALAR_FLUX_FUNCTIONS DUAL_FLUX_FUNCTIONS
+#else
+#define SCALAR_FLUX_FUNCTIONS FLUX_FUNCTIONS
+#endif
+
+/**
+ * \brief Perform the spacial operator of the finite volume scheme
+ *
+ * First, the spacial gradients inside of the cells are reconstructed.
+ * Following that, the numerical flux is calculated, using the specified flux
+ * function and the boundary conditions. Finally, the source term is evaluated
+ * and the time derivatives of all the elements are calculated. One such
+ * function is generated for every combination of flux function and
+ * reconstruction.
+ */
+SCALAR_FLUX_FUNCTIONS(FV_TIME_DERIVATIVES)
+
+/**
+ * \brief The specialized time derivatives, indexed by flux function and
+ *	reconstruction (first order, the limiter of the second order scheme or
+ *	the frozen limiter)
+ */
+void (*NAME(fvTimeDerivatives)[VANLEER + 1][4])(double time) = {
+	SCALAR_FLUX_FUNCTIONS(FV_TIME_DERIVATIVE_ENTRY)
+};
+
+#undef FV_TIME_DERIVATIVE
+#undef FV_TIME_DERIVATIVES
+#undef FV_TIME_DERIVATIVE_ENTRY
+#undef SCALAR_FLUX_FUNCTIONS
@@ -6,17 +6,112 @@
  * \date Tue 31 Mar 2020 05:18:40 PM CEST
  */
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
 #include <math.h>
+#include <stdbool.h>
+#include <omp.h>
 
 #include "main.h"
+#include "fluxCalculation.h"
 #include "mesh.h"
 #include "equation.h"
 #include "exactRiemann.h"
 #include "boundary.h"
 #include "linearSolver.h"
+#include "finiteVolume.h"
+#include "equationOfState.h"
+
+#define FACE_BLOCK 16384	/**< maximum number of faces per block */
+#define MAX_FACE_COLORS 64	/**< maximum number of face block colors */
+
+/* local variables */
+long faceBlockSize;			/**< number of faces per block */
+long nFaceColors;			/**< number of face block colors */
+long *colorBlockStart;			/**< offsets of the blocks of every
+					color in `colorBlock` */
+long *colorBlock;			/**< face block indices, sorted by color */
+
+/** \brief The selected flux function, for a batch of sides */
+void (*fluxBatch)(int nBatch, double pVarL[NVAR][FLUX_BATCH],
+		double pVarR[NVAR][FLUX_BATCH], double fluxLoc[NVAR][FLUX_BATCH]);
+
+/** \brief Jacobians of the selected flux function */
+void (*fluxJacobian)(double pVarL[NVAR], double pVarR[NVAR],
+		double dFdUL[NVAR][NVAR], double dFdUR[NVAR][NVAR]);
+
+/**
+ * \brief Jacobian of the physical flux in normal direction with respect to the
+ *	conservative variables
+ * \param[in] pVar Primitive state, rotated into normal direction
+ * \param[out] A The Jacobian dF / dU
+ */
+void physicalFluxJacobian(double pVar[NVAR], double A[NVAR][NVAR])
+{
+	double vx = pVar[VX], vy = pVar[VY];
+	double phi = 0.5 * gam1 * (vx * vx + vy * vy);
+	double H = gam * gam1q * pVar[P] / pVar[RHO] + 0.5 * (vx * vx + vy * vy);
+
+	A[0][0] = 0.0;
+	A[0][1] = 1.0;
+	A[0][2] = 0.0;
+	A[0][3] = 0.0;
+
+	A[1][0] = phi - vx * vx;
+	A[1][1] = (3.0 - gam) * vx;
+	A[1][2] = - gam1 * vy;
+	A[1][3] = gam1;
+
+	A[2][0] = - vx * vy;
+	A[2][1] = vy;
+	A[2][2] = vx;
+	A[2][3] = 0.0;
+
+	A[3][0] = vx * (phi - H);
+	A[3][1] = H - gam1 * vx * vx;
+	A[3][2] = - gam1 * vx * vy;
+	A[3][3] = gam * vx;
+}
 
 /**
- * \brief Godunov flux, which is the exact flux
+ * \brief Jacobians of the HLL type fluxes for given signal speeds
+ *
+ * The signal speeds are treated as constants.
+ *
+ * \param[in] pVarL Left side state, rotated into normal direction
+ * \param[in] pVarR Right side state, rotated into normal direction
+ * \param[in] alm Left signal speed
+ * \param[in] arp Right signal speed
+ * \param[out] dFdUL The Jacobian with respect to the left state
+ * \param[out] dFdUR The Jacobian with respect to the right state
+ */
+void hllJacobian(double pVarL[NVAR], double pVarR[NVAR], double alm,
+		double arp, double dFdUL[NVAR][NVAR], double dFdUR[NVAR][NVAR])
+{
+	physicalFluxJacobian(pVarL, dFdUL);
+	physicalFluxJacobian(pVarR, dFdUR);
+
+	if (alm > 0.0) {
+		memset(dFdUR, 0, sizeof(double[NVAR][NVAR]));
+	} else if (arp < 0.0) {
+		memset(dFdUL, 0, sizeof(double[NVAR][NVAR]));
+	} else {
+		double arpAlmQ = 1.0 / (arp - alm);
+		for (int i = 0; i < NVAR; ++i) {
+			dFdUL[i][i] -= alm;
+			dFdUR[i][i] -= arp;
+			for (int j = 0; j < NVAR; ++j) {
+				dFdUL[i][j] *= arp * arpAlmQ;
+				dFdUR[i][j] *= - alm * arpAlmQ;
+			}
+		}
+	}
+}
+
+/**
+ * \brief Godunov flux, using the adaptive solution of the Riemann problem
  * \param[in] rhoL Left side density
  * \param[in] rhoR Right side density
  * \param[in] vxL Left side x-velocity
@@ -37,7 +132,7 @@ void flux_god(double rhoL, double rhoR,
 	double cR = sqrt(gam * pR / rhoR);
 
 	double rho, vx, p;
-	exactRiemann(rhoL, rhoR, &rho, vxL, vxR, &vx, pL, pR, &p, cL, cR, 0.0);
+	adaptiveRiemann(rhoL, rhoR, &rho, vxL, vxR, &vx, pL, pR, &p, cL, cR, 0.0);
 
 	double vy;
 	if (vx > 0.0) {
@@ -52,146 +147,116 @@ void flux_god(double rhoL, double rhoR,
 	fluxLoc[3] = vx * (gam / gam1 * p + 0.5 * rho * (vx * vx + vy * vy));
 }
 
+#define SCALAR_KERNELS "fluxCalculationKernels.h"
+#include "scalar.h"
+
 /**
- * \brief Roe flux
- * \param[in] rhoL Left side density
- * \param[in] rhoR Right side density
- * \param[in] vxL Left side x-velocity
- * \param[in] vxR Right side x-velocity
- * \param[in] vyL Left side y-velocity
- * \param[in] vyR Right side y-velocity
- * \param[in] pL Left side pressure
- * \param[in] pR Right side pressure
- * \param[out] fluxLoc The local numeric flux
+ * \brief Jacobians of the Roe flux
+ *
+ * The Roe matrix, including the entropy fix, is treated as constant:
+ * dF / dUL = (A(UL) + |A_Roe|) / 2 and dF / dUR = (A(UR) - |A_Roe|) / 2. The
+ * columns of |A_Roe| are the dissipation of the flux for unit jumps of the
+ * conservative variables.
+ *
+ * \param[in] pVarL Left side state, rotated into normal direction
+ * \param[in] pVarR Right side state, rotated into normal direction
+ * \param[out] dFdUL The Jacobian with respect to the left state
+ * \param[out] dFdUR The Jacobian with respect to the right state
  */
-void flux_roe(double rhoL, double rhoR,
-	      double vxL,  double vxR,
-	      double vyL,  double vyR,
-	      double pL,   double pR,
-	      double fluxLoc[4])
+void flux_roe_jacobian(double pVarL[NVAR], double pVarR[NVAR],
+		double dFdUL[NVAR][NVAR], double dFdUR[NVAR][NVAR])
 {
-	/* calculate left/right enthalpy */
-	double mxL = rhoL * vxL;
-	double mxR = rhoR * vxR;
-	double myL = rhoL * vyL;
-	double myR = rhoR * vyR;
-
-	double eR = gam1q * pR + 0.5 * rhoR * (vxR * vxR + vyR * vyR);
-	double eL = gam1q * pL + 0.5 * rhoL * (vxL * vxL + vyL * vyL);
+	double rhoL = pVarL[RHO], rhoR = pVarR[RHO];
+	double vxL  = pVarL[VX],  vxR  = pVarR[VX];
+	double vyL  = pVarL[VY],  vyR  = pVarR[VY];
+	double pL   = pVarL[P],   pR   = pVarR[P];
 
 	/* calculate left/right enthalpy */
-	double HR = (eR + pR) / rhoR;
-	double HL = (eL + pL) / rhoL;
+	double HR = gam * gam1q * pR / rhoR + 0.5 * (vxR * vxR + vyR * vyR);
+	double HL = gam * gam1q * pL / rhoL + 0.5 * (vxL * vxL + vyL * vyL);
 
-	/* calculate sqrt(rho) */
+	/* calculate Roe mean values */
 	double rhoSqR = sqrt(rhoR);
 	double rhoSqL = sqrt(rhoL);
 	double rhoSqQsum = 1.0 / (rhoSqL + rhoSqR);
-
-	/* calculate Roe mean values */
 	double vxBar = (rhoSqR * vxR + rhoSqL * vxL) * rhoSqQsum;
 	double vyBar = (rhoSqR * vyR + rhoSqL * vyL) * rhoSqQsum;
 	double Hbar  = (rhoSqR *  HR + rhoSqL *  HL) * rhoSqQsum;
 	double cBar  = sqrt(gam1 * (Hbar - 0.5 * (vxBar * vxBar + vyBar * vyBar)));
 
-	/* calculate mean Eigenvalues */
-	double a[4] = {vxBar - cBar, vxBar, vxBar, vxBar + cBar};
-
-	/* calculate mean eigenvectors */
-	double r1[4] = {1.0, a[0], vyBar, Hbar - vxBar * cBar};
-	double r2[4] = {1.0, vxBar, vyBar, 0.5 * (vxBar * vxBar + vyBar * vyBar)};
-	double r3[4] = {0.0, 0.0, 1.0, vyBar};
-	double r4[4] = {1.0, a[3], vyBar, Hbar + vxBar * cBar};
-
-	/* calculate differences */
-	double delRho = rhoR - rhoL;
-	double delMx  = mxR  - mxL;
-	double delMy  = myR  - myL;
-	double delE   = eR   - eL;
-	double delEq  = delE - (delMy - vyBar * delRho) * vyBar;
-
-	/* calculate wave strenght */
-	double cBarQ = 1.0 / cBar;
-	double gam2 = - gam1 * cBarQ * cBarQ * (delRho * (vxBar * vxBar - Hbar)
-			+ delEq - delMx * vxBar);
-	double gam1 = - 0.5 * cBarQ * (delMx - delRho * (vxBar + cBar)) - 0.5 * gam2;
-	double gam4 = delRho - gam1 - gam2;
-	double gam3 = delMy - vyBar * delRho;
-
-	/* calculate physical fluxes */
-	double fR[4] = {mxR, mxR * vxR + pR, mxR * vyR, vxR * (eR + pR)};
-	double fL[4] = {mxL, mxL * vxL + pL, mxL * vyL, vxL * (eL + pL)};
+	/* mean Eigenvalues and energy components of the mean eigenvectors */
+	double a1 = vxBar - cBar;
+	double a2 = vxBar;
+	double a4 = vxBar + cBar;
+	double r1E = Hbar - vxBar * cBar;
+	double r2E = 0.5 * (vxBar * vxBar + vyBar * vyBar);
+	double r4E = Hbar + vxBar * cBar;
 
 	/* entropy fix */
 	double cL = sqrt(gam * pL / rhoL);
 	double cR = sqrt(gam * pR / rhoR);
-	double al[4] = {vxL - cL, vxL, vxL, vxL + cL};
-	double ar[4] = {vxR - cR, vxR, vxR, vxR + cR};
-	for (int i = 0; i < 4; ++i) {
-		double da = fmax(fmax(0.0, a[i] - al[i]), ar[i] - a[i]);
-		if (fabs(a[i]) < da) {
-			a[i] = 0.5 * (a[i] * a[i] / da + da);
-		} else {
-			a[i] = fabs(a[i]);
-		}
-	}
+	double da1 = fmax(fmax(0.0, a1 - (vxL - cL)), (vxR - cR) - a1);
+	double da2 = fmax(fmax(0.0, a2 - vxL), vxR - a2);
+	double da4 = fmax(fmax(0.0, a4 - (vxL + cL)), (vxR + cR) - a4);
+	double abs1 = (fabs(a1) < da1) ? 0.5 * (a1 * a1 / da1 + da1) : fabs(a1);
+	double abs2 = (fabs(a2) < da2) ? 0.5 * (a2 * a2 / da2 + da2) : fabs(a2);
+	double abs4 = (fabs(a4) < da4) ? 0.5 * (a4 * a4 / da4 + da4) : fabs(a4);
+
+	physicalFluxJacobian(pVarL, dFdUL);
+	physicalFluxJacobian(pVarR, dFdUR);
 
-	/* calculate Row flux */
-	for (int i = 0; i < 4; ++i) {
-		fluxLoc[i] = 0.5 * (fR[i] + fL[i]
-				- gam1 * fabs(a[0]) * r1[i]
-				- gam2 * fabs(a[1]) * r2[i]
-				- gam3 * fabs(a[2]) * r3[i]
-				- gam4 * fabs(a[3]) * r4[i]);
+	double cBarQ = 1.0 / cBar;
+	for (int j = 0; j < NVAR; ++j) {
+		double delU[NVAR] = {0.0};
+		delU[j] = 1.0;
+
+		/* wave strengths of the unit jump */
+		double delEq = delU[E] - (delU[MY] - vyBar * delU[RHO]) * vyBar;
+		double w2 = - gam1 * cBarQ * cBarQ * (delU[RHO] * (vxBar * vxBar - Hbar)
+				+ delEq - delU[MX] * vxBar);
+		double w1 = - 0.5 * cBarQ * (delU[MX] - delU[RHO] * (vxBar + cBar)) - 0.5 * w2;
+		double w4 = delU[RHO] - w1 - w2;
+		double w3 = delU[MY] - vyBar * delU[RHO];
+
+		double D[NVAR];
+		D[0] = w1 * abs1 + w2 * abs2 + w4 * abs4;
+		D[1] = w1 * abs1 * a1 + w2 * abs2 * vxBar + w4 * abs4 * a4;
+		D[2] = D[0] * vyBar + w3 * abs2;
+		D[3] = w1 * abs1 * r1E + w2 * abs2 * r2E + w3 * abs2 * vyBar
+			+ w4 * abs4 * r4E;
+
+		for (int i = 0; i < NVAR; ++i) {
+			dFdUL[i][j] = 0.5 * (dFdUL[i][j] + D[i]);
+			dFdUR[i][j] = 0.5 * (dFdUR[i][j] - D[i]);
+		}
 	}
 }
 
 /**
- * \brief HLL flux
- * \param[in] rhoL Left side density
- * \param[in] rhoR Right side density
- * \param[in] vxL Left side x-velocity
- * \param[in] vxR Right side x-velocity
- * \param[in] vyL Left side y-velocity
- * \param[in] vyR Right side y-velocity
- * \param[in] pL Left side pressure
- * \param[in] pR Right side pressure
- * \param[out] fluxLoc The local numeric flux
+ * \brief Jacobians of the HLL flux, with constant signal speeds
+ * \param[in] pVarL Left side state, rotated into normal direction
+ * \param[in] pVarR Right side state, rotated into normal direction
+ * \param[out] dFdUL The Jacobian with respect to the left state
+ * \param[out] dFdUR The Jacobian with respect to the right state
  */
-void flux_hll(double rhoL, double rhoR,
-	      double vxL,  double vxR,
-	      double vyL,  double vyR,
-	      double pL,   double pR,
-	      double fluxLoc[4])
+void flux_hll_jacobian(double pVarL[NVAR], double pVarR[NVAR],
+		double dFdUL[NVAR][NVAR], double dFdUR[NVAR][NVAR])
 {
-	/* calculation of auxiliary values */
-	double rhoLq = 1.0 / rhoL;
-	double rhoRq = 1.0 / rhoR;
+	double rhoL = pVarL[RHO], rhoR = pVarR[RHO];
+	double vxL  = pVarL[VX],  vxR  = pVarR[VX];
+	double vyL  = pVarL[VY],  vyR  = pVarR[VY];
+	double pL   = pVarL[P],   pR   = pVarR[P];
+
+	/* calculation of speed of sounds and enthalpy */
+	double cL = sqrt(gam * pL / rhoL);
+	double cR = sqrt(gam * pR / rhoR);
+	double HL = gam1q * cL * cL + 0.5 * (vxL * vxL + vyL * vyL);
+	double HR = gam1q * cR * cR + 0.5 * (vxR * vxR + vyR * vyR);
+
+	/* calculation Roe mean values */
 	double rhoSqL = sqrt(rhoL);
 	double rhoSqR = sqrt(rhoR);
 	double rhoSqQsum = 1.0 / (rhoSqL + rhoSqR);
-
-	/* calculate energies */
-	double eR = gam1q * pR + 0.5 * rhoR * (vxR * vxR + vyR * vyR);
-	double eL = gam1q * pL + 0.5 * rhoL * (vxL * vxL + vyL * vyL);
-
-	/* calculate left/right conservative state vector */
-	double uL[NVAR] = {rhoL, rhoL * vxL, rhoL * vyL, eL};
-	double uR[NVAR] = {rhoR, rhoR * vxR, rhoR * vyR, eR};
-
-	/* calculate flux in left/right cell */
-	double fL[NVAR] = {uL[MX], uL[MX] * vxL + pL, uL[MX] * vyL, vxL * (eL + pL)};
-	double fR[NVAR] = {uR[MX], uR[MX] * vxR + pR, uR[MX] * vyR, vxR * (eR + pR)};
-
-	/* calculation of speed of sounds */
-	double cL = sqrt(gam * pL * rhoLq);
-	double cR = sqrt(gam * pR * rhoRq);
-
-	/* calculation of left/right enthalpy */
-	double HL = (eL + pL) * rhoLq;
-	double HR = (eR + pR) * rhoRq;
-
-	/* calculation Row mean values */
 	double uM = (rhoSqR * vxR + rhoSqL * vxL) * rhoSqQsum;
 	double vM = (rhoSqR * vyR + rhoSqL * vyL) * rhoSqQsum;
 	double HM = (rhoSqR *  HR + rhoSqL *  HL) * rhoSqQsum;
@@ -200,73 +265,32 @@ void flux_hll(double rhoL, double rhoR,
 	/* calculation signal speeds */
 	double arp = fmax(vxR + cR, uM + cM);
 	double alm = fmin(vxL - cL, uM - cM);
-	double arpAlmQ = 1.0 / (arp - alm);
 
-	/* calculation HLL flux */
-	if (alm > 0.0) {
-		fluxLoc[0] = fL[0];
-		fluxLoc[1] = fL[1];
-		fluxLoc[2] = fL[2];
-		fluxLoc[3] = fL[3];
-	} else if (arp < 0.0) {
-		fluxLoc[0] = fR[0];
-		fluxLoc[1] = fR[1];
-		fluxLoc[2] = fR[2];
-		fluxLoc[3] = fR[3];
-	} else {
-		fluxLoc[0] = (arp * fL[0] - alm * fR[0]) * arpAlmQ
-			   + (arp * alm) * arpAlmQ * (uR[0] - uL[0]);
-		fluxLoc[1] = (arp * fL[1] - alm * fR[1]) * arpAlmQ
-			   + (arp * alm) * arpAlmQ * (uR[1] - uL[1]);
-		fluxLoc[2] = (arp * fL[2] - alm * fR[2]) * arpAlmQ
-			   + (arp * alm) * arpAlmQ * (uR[2] - uL[2]);
-		fluxLoc[3] = (arp * fL[3] - alm * fR[3]) * arpAlmQ
-			   + (arp * alm) * arpAlmQ * (uR[3] - uL[3]);
-	}
+	hllJacobian(pVarL, pVarR, alm, arp, dFdUL, dFdUR);
 }
 
 /**
- * \brief HLLE flux
- * \param[in] rhoL Left side density
- * \param[in] rhoR Right side density
- * \param[in] vxL Left side x-velocity
- * \param[in] vxR Right side x-velocity
- * \param[in] vyL Left side y-velocity
- * \param[in] vyR Right side y-velocity
- * \param[in] pL Left side pressure
- * \param[in] pR Right side pressure
- * \param[out] fluxLoc The local numeric flux
+ * \brief Jacobians of the HLLE flux, with constant signal speeds
+ * \param[in] pVarL Left side state, rotated into normal direction
+ * \param[in] pVarR Right side state, rotated into normal direction
+ * \param[out] dFdUL The Jacobian with respect to the left state
+ * \param[out] dFdUR The Jacobian with respect to the right state
  */
-void flux_hlle(double rhoL, double rhoR,
-	       double vxL,  double vxR,
-	       double vyL,  double vyR,
-	       double pL,   double pR,
-	       double fluxLoc[4])
+void flux_hlle_jacobian(double pVarL[NVAR], double pVarR[NVAR],
+		double dFdUL[NVAR][NVAR], double dFdUR[NVAR][NVAR])
 {
-	/* calculation of auxiliary values */
-	double rhoLq = 1.0 / rhoL;
-	double rhoRq = 1.0 / rhoR;
-	double rhoSqL = sqrt(rhoL);
-	double rhoSqR = sqrt(rhoR);
-	double rhoSqQsum = 1.0 / (rhoSqL + rhoSqR);
-
-	/* calculate energies */
-	double eR = gam1q * pR + 0.5 * rhoR * (vxR * vxR + vyR * vyR);
-	double eL = gam1q * pL + 0.5 * rhoL * (vxL * vxL + vyL * vyL);
-
-	/* calculate left/right conservative state vector */
-	double uL[NVAR] = {rhoL, rhoL * vxL, rhoL * vyL, eL};
-	double uR[NVAR] = {rhoR, rhoR * vxR, rhoR * vyR, eR};
-
-	/* calculate flux in left/right cell */
-	double fL[NVAR] = {uL[MX], uL[MX] * vxL + pL, uL[MX] * vyL, vxL * (eL + pL)};
-	double fR[NVAR] = {uR[MX], uR[MX] * vxR + pR, uR[MX] * vyR, vxR * (eR + pR)};
+	double rhoL = pVarL[RHO], rhoR = pVarR[RHO];
+	double vxL  = pVarL[VX],  vxR  = pVarR[VX];
+	double pL   = pVarL[P],   pR   = pVarR[P];
 
 	/* calculation of speed of sounds */
-	double cL = sqrt(gam * pL * rhoLq);
-	double cR = sqrt(gam * pR * rhoRq);
+	double cL = sqrt(gam * pL / rhoL);
+	double cR = sqrt(gam * pR / rhoR);
 
-	/* calculation Row mean values */
+	/* calculation Roe mean values */
+	double rhoSqL = sqrt(rhoL);
+	double rhoSqR = sqrt(rhoR);
+	double rhoSqQsum = 1.0 / (rhoSqL + rhoSqR);
 	double uM = (rhoSqR * vxR + rhoSqL * vxL) * rhoSqQsum;
 
 	/* signal speeds, version of Einfeld paper */
@@ -275,77 +299,90 @@ void flux_hlle(double rhoL, double rhoR,
 			+ eta2 * (vxR - vxL) * (vxR - vxL));
 	double arp = fmax(vxR + cR, uM + d);
 	double alm = fmin(vxL - cL, uM - d);
-	double arpAlmQ = 1.0 / (arp - alm);
 
-	/* calculation HLLE flux */
-	if (alm > 0.0) {
-		fluxLoc[0] = fL[0];
-		fluxLoc[1] = fL[1];
-		fluxLoc[2] = fL[2];
-		fluxLoc[3] = fL[3];
-	} else if (arp < 0.0) {
-		fluxLoc[0] = fR[0];
-		fluxLoc[1] = fR[1];
-		fluxLoc[2] = fR[2];
-		fluxLoc[3] = fR[3];
-	} else {
-		fluxLoc[0] = (arp * fL[0] - alm * fR[0]) * arpAlmQ
-			   + (arp * alm) * arpAlmQ * (uR[0] - uL[0]);
-		fluxLoc[1] = (arp * fL[1] - alm * fR[1]) * arpAlmQ
-			   + (arp * alm) * arpAlmQ * (uR[1] - uL[1]);
-		fluxLoc[2] = (arp * fL[2] - alm * fR[2]) * arpAlmQ
-			   + (arp * alm) * arpAlmQ * (uR[2] - uL[2]);
-		fluxLoc[3] = (arp * fL[3] - alm * fR[3]) * arpAlmQ
-			   + (arp * alm) * arpAlmQ * (uR[3] - uL[3]);
-	}
+	hllJacobian(pVarL, pVarR, alm, arp, dFdUL, dFdUR);
 }
 
 /**
- * \brief HLLC flux
- * \param[in] rhoL Left side density
- * \param[in] rhoR Right side density
- * \param[in] vxL Left side x-velocity
- * \param[in] vxR Right side x-velocity
- * \param[in] vyL Left side y-velocity
- * \param[in] vyR Right side y-velocity
- * \param[in] pL Left side pressure
- * \param[in] pR Right side pressure
- * \param[out] fluxLoc The local numeric flux
+ * \brief Derivatives of an HLLC star state
+ * \param[in] pVar Primitive state of the side of the star state, rotated into
+ *	normal direction
+ * \param[in] a Signal speed of the side
+ * \param[in] as Speed of the contact wave
+ * \param[out] dUsdW Derivative of the star state with respect to the
+ *	primitive state, for a constant contact wave speed
+ * \param[out] dUsdS Derivative of the star state with respect to the contact
+ *	wave speed
  */
-void flux_hllc(double rhoL, double rhoR,
-	       double vxL,  double vxR,
-	       double vyL,  double vyR,
-	       double pL,   double pR,
-	       double fluxLoc[4])
+void hllcStarJacobian(double pVar[NVAR], double a, double as,
+		double dUsdW[NVAR][NVAR], double dUsdS[NVAR])
 {
-	/* calculation of auxiliary values */
-	double rhoLq = 1.0 / rhoL;
-	double rhoRq = 1.0 / rhoR;
-	double rhoSqL = sqrt(rhoL);
-	double rhoSqR = sqrt(rhoR);
-	double rhoSqQsum = 1.0 / (rhoSqL + rhoSqR);
-
-	/* calculate energies */
-	double eR = gam1q * pR + 0.5 * rhoR * (vxR * vxR + vyR * vyR);
-	double eL = gam1q * pL + 0.5 * rhoL * (vxL * vxL + vyL * vyL);
-
-	/* calculate left/right conservative state vector */
-	double uL[NVAR] = {rhoL, rhoL * vxL, rhoL * vyL, eL};
-	double uR[NVAR] = {rhoR, rhoR * vxR, rhoR * vyR, eR};
-
-	/* calculate flux in left/right cell */
-	double fL[NVAR] = {uL[MX], uL[MX] * vxL + pL, uL[MX] * vyL, vxL * (eL + pL)};
-	double fR[NVAR] = {uR[MX], uR[MX] * vxR + pR, uR[MX] * vyR, vxR * (eR + pR)};
+	double rho = pVar[RHO], vx = pVar[VX], vy = pVar[VY], p = pVar[P];
+	double q2 = vx * vx + vy * vy;
+	double e = gam1q * p + 0.5 * rho * q2;
+
+	double k = 1.0 / (a - as);
+	double fac = rho * (a - vx) * k;
+	double es = k * ((a - vx) * e + rho * (a - vx) * (as - vx) * as
+			+ (as - vx) * p);
+
+	dUsdW[0][RHO] = (a - vx) * k;
+	dUsdW[0][VX]  = - rho * k;
+	dUsdW[0][VY]  = 0.0;
+	dUsdW[0][P]   = 0.0;
+
+	dUsdW[1][RHO] = as * dUsdW[0][RHO];
+	dUsdW[1][VX]  = as * dUsdW[0][VX];
+	dUsdW[1][VY]  = 0.0;
+	dUsdW[1][P]   = 0.0;
+
+	dUsdW[2][RHO] = vy * dUsdW[0][RHO];
+	dUsdW[2][VX]  = vy * dUsdW[0][VX];
+	dUsdW[2][VY]  = fac;
+	dUsdW[2][P]   = 0.0;
+
+	dUsdW[3][RHO] = k * (a - vx) * (0.5 * q2 + (as - vx) * as);
+	dUsdW[3][VX]  = k * (- e + (a - vx) * rho * vx
+			- rho * as * ((as - vx) + (a - vx)) - p);
+	dUsdW[3][VY]  = k * (a - vx) * rho * vy;
+	dUsdW[3][P]   = k * ((a - vx) * gam1q + (as - vx));
+
+	dUsdS[0] = fac * k;
+	dUsdS[1] = fac + as * fac * k;
+	dUsdS[2] = vy * fac * k;
+	dUsdS[3] = k * es + k * (rho * (a - vx) * (2.0 * as - vx) + p);
+}
 
-	/* calculation of speed of sounds */
-	double cL = sqrt(gam * pL * rhoLq);
-	double cR = sqrt(gam * pR * rhoRq);
+/**
+ * \brief Jacobians of the HLLC flux
+ *
+ * The outer signal speeds are treated as constants, the dependence of the
+ * contact wave speed on both states is taken into account, as it couples the
+ * star state flux to the state on the other side.
+ *
+ * \param[in] pVarL Left side state, rotated into normal direction
+ * \param[in] pVarR Right side state, rotated into normal direction
+ * \param[out] dFdUL The Jacobian with respect to the left state
+ * \param[out] dFdUR The Jacobian with respect to the right state
+ */
+void flux_hllc_jacobian(double pVarL[NVAR], double pVarR[NVAR],
+		double dFdUL[NVAR][NVAR], double dFdUR[NVAR][NVAR])
+{
+	double rhoL = pVarL[RHO], rhoR = pVarR[RHO];
+	double vxL  = pVarL[VX],  vxR  = pVarR[VX];
+	double vyL  = pVarL[VY],  vyR  = pVarR[VY];
+	double pL   = pVarL[P],   pR   = pVarR[P];
 
-	/* calculation of left/right enthalpy */
-	double HL = (eL + pL) * rhoLq;
-	double HR = (eR + pR) * rhoRq;
+	/* calculation of speed of sounds and enthalpy */
+	double cL = sqrt(gam * pL / rhoL);
+	double cR = sqrt(gam * pR / rhoR);
+	double HL = gam1q * cL * cL + 0.5 * (vxL * vxL + vyL * vyL);
+	double HR = gam1q * cR * cR + 0.5 * (vxR * vxR + vyR * vyR);
 
-	/* calculation Row mean values */
+	/* calculation Roe mean values */
+	double rhoSqL = sqrt(rhoL);
+	double rhoSqR = sqrt(rhoR);
+	double rhoSqQsum = 1.0 / (rhoSqL + rhoSqR);
 	double uM = (rhoSqR * vxR + rhoSqL * vxL) * rhoSqQsum;
 	double vM = (rhoSqR * vyR + rhoSqL * vyL) * rhoSqQsum;
 	double HM = (rhoSqR *  HR + rhoSqL *  HL) * rhoSqQsum;
@@ -355,644 +392,773 @@ void flux_hllc(double rhoL, double rhoR,
 	double arp = fmax(vxR + cR, uM + cM);
 	double alm = fmin(vxL - cL, uM - cM);
 
-	/* calculation HLL flux */
-	if (alm > 0.0) {
-		fluxLoc[0] = fL[0];
-		fluxLoc[1] = fL[1];
-		fluxLoc[2] = fL[2];
-		fluxLoc[3] = fL[3];
-	} else if (arp < 0.0) {
-		fluxLoc[0] = fR[0];
-		fluxLoc[1] = fR[1];
-		fluxLoc[2] = fR[2];
-		fluxLoc[3] = fR[3];
-	} else {
-		double as = (pR - pL + uL[MX] * (alm - vxL) - uR[MX] * (arp - vxR))
-			/ (rhoL * (alm - vxL) - rhoR * (arp - vxR));
-		if ((alm <= 0.0) && (as >= 0.0)) {
-			double fac = rhoL * (alm - vxL) / (alm - as);
-			double us[NVAR] = {fac,
-					   as * fac,
-					   vyL * fac,
-					   fac * (eL / rhoL + (as - vxL) *
-						(as + pL / (rhoL * (alm - vxL))))};
-			fluxLoc[0] = fL[0] + alm * (us[0] - uL[0]);
-			fluxLoc[1] = fL[1] + alm * (us[1] - uL[1]);
-			fluxLoc[2] = fL[2] + alm * (us[2] - uL[2]);
-			fluxLoc[3] = fL[3] + alm * (us[3] - uL[3]);
-		} else {
-			double fac = rhoR * (arp - vxR) / (arp - as);
-			double us[NVAR] = {fac,
-					   as * fac,
-					   vyR * fac,
-					   fac * (eR / rhoR + (as - vxR) *
-						(as + pR / (rhoR * (arp - vxR))))};
-			fluxLoc[0] = fR[0] + arp * (us[0] - uR[0]);
-			fluxLoc[1] = fR[1] + arp * (us[1] - uR[1]);
-			fluxLoc[2] = fR[2] + arp * (us[2] - uR[2]);
-			fluxLoc[3] = fR[3] + arp * (us[3] - uR[3]);
+	if ((alm > 0.0) || (arp < 0.0)) {
+		hllJacobian(pVarL, pVarR, alm, arp, dFdUL, dFdUR);
+		return;
+	}
+
+	/* contact wave speed and its derivatives */
+	double den = rhoL * (alm - vxL) - rhoR * (arp - vxR);
+	double as = (pR - pL + rhoL * vxL * (alm - vxL) - rhoR * vxR * (arp - vxR))
+		/ den;
+	double dSdWL[NVAR] = {
+		(vxL - as) * (alm - vxL) / den,
+		rhoL * (alm - 2.0 * vxL + as) / den,
+		0.0,
+		- 1.0 / den
+	};
+	double dSdWR[NVAR] = {
+		- (vxR - as) * (arp - vxR) / den,
+		- rhoR * (arp - 2.0 * vxR + as) / den,
+		0.0,
+		1.0 / den
+	};
+
+	/* the flux is given by the star state of the upwind side K, the other
+	 * side O only enters through the contact wave speed */
+	bool isLeft = (as >= 0.0);
+	double *pVarK = isLeft ? pVarL : pVarR;
+	double *pVarO = isLeft ? pVarR : pVarL;
+	double *dSdWK = isLeft ? dSdWL : dSdWR;
+	double *dSdWO = isLeft ? dSdWR : dSdWL;
+	double (*dFdUK)[NVAR] = isLeft ? dFdUL : dFdUR;
+	double (*dFdUO)[NVAR] = isLeft ? dFdUR : dFdUL;
+	double aK = isLeft ? alm : arp;
+
+	double dUsdW[NVAR][NVAR], dUsdS[NVAR];
+	hllcStarJacobian(pVarK, aK, as, dUsdW, dUsdS);
+
+	double dWdUK[NVAR][NVAR], dWdUO[NVAR][NVAR];
+	consPrimJacobian(pVarK, dWdUK);
+	consPrimJacobian(pVarO, dWdUO);
+
+	/* F = F(UK) + aK * (Us - UK) */
+	physicalFluxJacobian(pVarK, dFdUK);
+	for (int i = 0; i < NVAR; ++i) {
+		for (int j = 0; j < NVAR; ++j) {
+			double dUsdUK = 0.0, dUsdUO = 0.0;
+			for (int k = 0; k < NVAR; ++k) {
+				dUsdUK += (dUsdW[i][k] + dUsdS[i] * dSdWK[k]) * dWdUK[k][j];
+				dUsdUO += dUsdS[i] * dSdWO[k] * dWdUO[k][j];
+			}
+			dFdUK[i][j] += aK * (dUsdUK - (i == j ? 1.0 : 0.0));
+			dFdUO[i][j] = aK * dUsdUO;
 		}
 	}
 }
 
 /**
- * \brief Lax-Friedrichs flux
- * \param[in] rhoL Left side density
- * \param[in] rhoR Right side density
- * \param[in] vxL Left side x-velocity
- * \param[in] vxR Right side x-velocity
- * \param[in] vyL Left side y-velocity
- * \param[in] vyR Right side y-velocity
- * \param[in] pL Left side pressure
- * \param[in] pR Right side pressure
- * \param[out] fluxLoc The local numeric flux
+ * \brief Jacobians of the Lax-Friedrichs flux, with a constant maximum
+ *	Eigenvalue
+ * \param[in] pVarL Left side state, rotated into normal direction
+ * \param[in] pVarR Right side state, rotated into normal direction
+ * \param[out] dFdUL The Jacobian with respect to the left state
+ * \param[out] dFdUR The Jacobian with respect to the right state
  */
-void flux_lxf(double rhoL, double rhoR,
-	      double vxL,  double vxR,
-	      double vyL,  double vyR,
-	      double pL,   double pR,
-	      double fluxLoc[4])
+void flux_lxf_jacobian(double pVarL[NVAR], double pVarR[NVAR],
+		double dFdUL[NVAR][NVAR], double dFdUR[NVAR][NVAR])
 {
 	/* compute maximum Eigenvalue */
-	double cL = sqrt(gam * pL / rhoL);
-	double cR = sqrt(gam * pR / rhoR);
-	double a  = fmax(fabs(vxR) + cR, fabs(vxL) + cL);
-
-	/* calculate left/right energy and enthalpy */
-	double eL = gam1q * pL + 0.5 * rhoL * (vxL * vxL + vyL * vyL);
-	double eR = gam1q * pR + 0.5 * rhoR * (vxR * vxR + vyR * vyR);
-
-	/* calculate the differences of the conservative variables */
-	double delU[NVAR] = {rhoR       - rhoL,
-			     rhoR * vxR - rhoL * vxL,
-			     rhoR * vyR - rhoL * vyL,
-			     eR         - eL};
-
-	/* calculate the physical fluxes */
-	double fL[4] = {rhoL * vxL,
-			 rhoL * vxL * vxL + pL,
-			 rhoL * vxL * vyL,
-			 vxL * (eL + pL)};
-	double fR[4] = {rhoR * vxR,
-			 rhoR * vxR * vxR + pR,
-			 rhoR * vxR * vyR,
-			 vxR * (eR + pR)};
-
-	/* calculate local Lax-Friedrichs flux */
-	fluxLoc[0] = 0.5 * (fR[0] + fL[0]) - 0.5 * a * delU[0];
-	fluxLoc[1] = 0.5 * (fR[1] + fL[1]) - 0.5 * a * delU[1];
-	fluxLoc[2] = 0.5 * (fR[2] + fL[2]) - 0.5 * a * delU[2];
-	fluxLoc[3] = 0.5 * (fR[3] + fL[3]) - 0.5 * a * delU[3];
+	double cL = sqrt(gam * pVarL[P] / pVarL[RHO]);
+	double cR = sqrt(gam * pVarR[P] / pVarR[RHO]);
+	double a  = fmax(fabs(pVarR[VX]) + cR, fabs(pVarL[VX]) + cL);
+
+	physicalFluxJacobian(pVarL, dFdUL);
+	physicalFluxJacobian(pVarR, dFdUR);
+	for (int i = 0; i < NVAR; ++i) {
+		dFdUL[i][i] += a;
+		dFdUR[i][i] -= a;
+		for (int j = 0; j < NVAR; ++j) {
+			dFdUL[i][j] *= 0.5;
+			dFdUR[i][j] *= 0.5;
+		}
+	}
 }
 
 /**
- * \brief Steger-Warming flux
- * \param[in] rhoL Left side density
- * \param[in] rhoR Right side density
- * \param[in] vxL Left side x-velocity
- * \param[in] vxR Right side x-velocity
- * \param[in] vyL Left side y-velocity
- * \param[in] vyR Right side y-velocity
- * \param[in] pL Left side pressure
- * \param[in] pR Right side pressure
- * \param[out] fluxLoc The local numeric flux
+ * \brief Jacobians of the central flux
+ * \param[in] pVarL Left side state, rotated into normal direction
+ * \param[in] pVarR Right side state, rotated into normal direction
+ * \param[out] dFdUL The Jacobian with respect to the left state
+ * \param[out] dFdUR The Jacobian with respect to the right state
  */
-void flux_stw(double rhoL, double rhoR,
-	      double vxL,  double vxR,
-	      double vyL,  double vyR,
-	      double pL,   double pR,
-	      double fluxLoc[4])
+void flux_cen_jacobian(double pVarL[NVAR], double pVarR[NVAR],
+		double dFdUL[NVAR][NVAR], double dFdUR[NVAR][NVAR])
 {
-	/* calculation of speed of sound */
-	double cL = sqrt(gam * pL / rhoL);
-	double cR = sqrt(gam * pR / rhoR);
-
-	/* auxiliary values */
-	double gam2q = 0.5 / gam;
-
-	/* calculation of eigenvalues */
-	double aL[4] = {vxL - cL, vxL, vxL, vxL + cL};
-	double aR[4] = {vxR - cR, vxR, vxR, vxR + cR};
-
-	/* calculation of positive and negative Eigenvalues */
-	double ap[4] = {fmax(aL[0], 0.0),
-			fmax(aL[1], 0.0),
-			fmax(aL[2], 0.0),
-			fmax(aL[3], 0.0)};
-	double am[4] = {fmin(aR[0], 0.0),
-			fmin(aR[1], 0.0),
-			fmin(aR[2], 0.0),
-			fmin(aR[3], 0.0)};
-
-	/* calculate positve flux from left and right */
-	double fp[4];
-	fp[0] =	rhoL * gam2q * (2.0 * gam1 * ap[1] + ap[0] + ap[3]);
-	fp[1] = fp[0] * vxL + (ap[3] - ap[0])* rhoL * cL * gam2q;
-	fp[2] = fp[0] * vyL;
-	fp[3] = fp[0] * 0.5 * (vxL * vxL + vyL * vyL) + (ap[3] - ap[0])*
-			rhoL * cL * vxL * gam2q + (ap[3] + ap[0]) *
-			rhoL * cL * cL * gam2q * gam1q;
-
-	/* calculate negative flux from right and left */
-	double fm[4];
-	fm[0] =	rhoR * gam2q * (2.0 * gam1 * am[1] + am[0] + am[3]);
-	fm[1] = fm[0] * vxR + (am[3] - am[0])* rhoR * cR * gam2q;
-	fm[2] = fm[0] * vyR;
-	fm[3] = fm[0] * 0.5 * (vxR * vxR + vyR * vyR) + (am[3] - am[0])*
-			rhoR * cR * vxR * gam2q + (am[3] + am[0]) *
-			rhoR * cR * cR * gam2q * gam1q;
-	/* calculate  Steger-Warming flux */
-	fluxLoc[0] = fp[0] + fm[0];
-	fluxLoc[1] = fp[1] + fm[1];
-	fluxLoc[2] = fp[2] + fm[2];
-	fluxLoc[3] = fp[3] + fm[3];
-}
-
-/**
- * \brief Central flux
- * \note This flux is unconditionally unstable, it can be stabilized by adding artificial viscosity (Jameson method). This is not implemented, however.
- * \param[in] rhoL Left side density
- * \param[in] rhoR Right side density
- * \param[in] vxL Left side x-velocity
- * \param[in] vxR Right side x-velocity
- * \param[in] vyL Left side y-velocity
- * \param[in] vyR Right side y-velocity
- * \param[in] pL Left side pressure
- * \param[in] pR Right side pressure
- * \param[out] fluxLoc The local numeric flux
- */
-void flux_cen(double rhoL, double rhoR,
-	      double vxL,  double vxR,
-	      double vyL,  double vyR,
-	      double pL,   double pR,
-	      double fluxLoc[4])
-{
-	/* calculate energies */
-	double eL = gam1q * pL + 0.5 * rhoL * (vxL * vxL + vyL * vyL);
-	double eR = gam1q * pR + 0.5 * rhoR * (vxR * vxR + vyR * vyR);
-
-	/* calculate the physical fluxes */
-	double fL[4], fR[4];
-	fL[0] = rhoL * vxL;
-	fL[1] = fL[0] * vxL + pL;
-	fL[2] = fL[0] * vyL;
-	fL[3] = vxL * (eL + pL);
-
-	fR[0] = rhoR * vxR;
-	fR[1] = fR[0] * vxR + pR;
-	fR[2] = fR[0] * vyR;
-	fR[3] = vxR * (eR + pR);
-
-	/* calculate central flux */
-	fluxLoc[0] = 0.5 * (fL[0] + fR[0]);
-	fluxLoc[1] = 0.5 * (fL[1] + fR[1]);
-	fluxLoc[2] = 0.5 * (fL[2] + fR[2]);
-	fluxLoc[3] = 0.5 * (fL[3] + fR[3]);
+	physicalFluxJacobian(pVarL, dFdUL);
+	physicalFluxJacobian(pVarR, dFdUR);
+	for (int i = 0; i < NVAR; ++i) {
+		for (int j = 0; j < NVAR; ++j) {
+			dFdUL[i][j] *= 0.5;
+			dFdUR[i][j] *= 0.5;
+		}
+	}
 }
 
 /**
- * \brief AUSMD flux
- * \param[in] rhoL Left side density
- * \param[in] rhoR Right side density
- * \param[in] vxL Left side x-velocity
- * \param[in] vxR Right side x-velocity
- * \param[in] vyL Left side y-velocity
- * \param[in] vyR Right side y-velocity
- * \param[in] pL Left side pressure
- * \param[in] pR Right side pressure
- * \param[out] fluxLoc The local numeric flux
+ * \brief Jacobians of the AUSMD flux
+ *
+ * The split velocities and pressures are differentiated in each regime,
+ * including their dependence on the common speed of sound and the pressure
+ * weights alphaL and alphaR, which couple them to the state on the other
+ * side.
+ *
+ * \param[in] pVarL Left side state, rotated into normal direction
+ * \param[in] pVarR Right side state, rotated into normal direction
+ * \param[out] dFdUL The Jacobian with respect to the left state
+ * \param[out] dFdUR The Jacobian with respect to the right state
  */
-void flux_ausmd(double rhoL, double rhoR,
-	        double vxL,  double vxR,
-	        double vyL,  double vyR,
-	        double pL,   double pR,
-	        double fluxLoc[4])
+void flux_ausmd_jacobian(double pVarL[NVAR], double pVarR[NVAR],
+		double dFdUL[NVAR][NVAR], double dFdUR[NVAR][NVAR])
 {
-	/* calculate left/right energy and enthalpy */
-	double eL = gam1q * pL + 0.5 * rhoL * (vxL * vxL + vyL * vyL);
-	double eR = gam1q * pR + 0.5 * rhoR * (vxR * vxR + vyR * vyR);
-
-	double HL = (eL + pL) / rhoL;
-	double HR = (eR + pR) / rhoR;
+	double rhoL = pVarL[RHO], rhoR = pVarR[RHO];
+	double vxL  = pVarL[VX],  vxR  = pVarR[VX];
+	double pL   = pVarL[P],   pR   = pVarR[P];
 
-	/* maximum speed of sound */
-	double cm = fmax(sqrt(gam * pL / rhoL), sqrt(gam * pR / rhoR));
-
-	double alphaL = 2.0 * pL / rhoL / (pL / rhoL + pR / rhoR);
-	double alphaR = 2.0 * pR / rhoR / (pL / rhoL + pR / rhoR);
+	/* maximum speed of sound and its derivatives */
+	double cL = sqrt(gam * pL / rhoL);
+	double cR = sqrt(gam * pR / rhoR);
+	double cm = fmax(cL, cR);
+	double dcmdWL[NVAR] = {0.0}, dcmdWR[NVAR] = {0.0};
+	if (cL >= cR) {
+		dcmdWL[RHO] = - 0.5 * cL / rhoL;
+		dcmdWL[P]   = 0.5 * cL / pL;
+	} else {
+		dcmdWR[RHO] = - 0.5 * cR / rhoR;
+		dcmdWR[P]   = 0.5 * cR / pR;
+	}
 
-	double uPlus, pPlus;
+	/* pressure weights and their derivatives */
+	double sL = pL / rhoL, sR = pR / rhoR;
+	double alphaL = 2.0 * sL / (sL + sR);
+	double alphaR = 2.0 * sR / (sL + sR);
+	double sSumQ2 = 2.0 / ((sL + sR) * (sL + sR));
+	double dsLdWL[NVAR] = {- sL / rhoL, 0.0, 0.0, 1.0 / rhoL};
+	double dsRdWR[NVAR] = {- sR / rhoR, 0.0, 0.0, 1.0 / rhoR};
+
+	/* split velocities and pressure weights, with their derivatives with
+	 * respect to the velocity, the speed of sound and alpha */
+	double uPlus, duPlus, dcPlus = 0.0, daPlus = 0.0;
+	double pWPlus, dpWPlus, dcpWPlus = 0.0;
 	if (fabs(vxL) < cm) {
 		uPlus = 0.25 * alphaL * (vxL + cm) * (vxL + cm) / cm
 			+ 0.5 * (1.0 - alphaL) * (vxL + fabs(vxL));
-		pPlus = 0.25 * pL * (vxL + cm) * (vxL + cm) / (cm * cm) * (2.0 - vxL / cm);
+		duPlus = 0.5 * alphaL * (vxL + cm) / cm
+			+ (1.0 - alphaL) * (vxL > 0.0 ? 1.0 : 0.0);
+		dcPlus = 0.25 * alphaL * (vxL + cm) * (cm - vxL) / (cm * cm);
+		daPlus = 0.25 * (vxL + cm) * (vxL + cm) / cm - 0.5 * (vxL + fabs(vxL));
+		pWPlus = 0.25 * (vxL + cm) * (vxL + cm) / (cm * cm) * (2.0 - vxL / cm);
+		dpWPlus = 0.5 * (vxL + cm) / (cm * cm) * (2.0 - vxL / cm)
+			- 0.25 * (vxL + cm) * (vxL + cm) / (cm * cm * cm);
+		dcpWPlus = 0.75 * vxL * (vxL + cm) * (vxL - cm) / (cm * cm * cm * cm);
 	} else {
-		uPlus = 0.5 * (vxL + fabs(vxL));
-		pPlus = 0.5 * pL * (vxL + fabs(vxL)) / vxL;
+		uPlus = (vxL > 0.0 ? vxL : 0.0);
+		duPlus = (vxL > 0.0 ? 1.0 : 0.0);
+		pWPlus = (vxL > 0.0 ? 1.0 : 0.0);
+		dpWPlus = 0.0;
 	}
 
-	double uMinus, pMinus;
+	double uMinus, duMinus, dcMinus = 0.0, daMinus = 0.0;
+	double pWMinus, dpWMinus, dcpWMinus = 0.0;
 	if (fabs(vxR) < cm) {
 		uMinus = - 0.25 * alphaR * (vxR - cm) * (vxR - cm) / cm
 			+ 0.5 * (1.0 - alphaR) * (vxR - fabs(vxR));
-		pMinus = 0.25 * pR * (vxR - cm) * (vxR - cm) / (cm * cm) * (2.0 + vxR / cm);
+		duMinus = - 0.5 * alphaR * (vxR - cm) / cm
+			+ (1.0 - alphaR) * (vxR < 0.0 ? 1.0 : 0.0);
+		dcMinus = 0.25 * alphaR * (vxR - cm) * (vxR + cm) / (cm * cm);
+		daMinus = - 0.25 * (vxR - cm) * (vxR - cm) / cm - 0.5 * (vxR - fabs(vxR));
+		pWMinus = 0.25 * (vxR - cm) * (vxR - cm) / (cm * cm) * (2.0 + vxR / cm);
+		dpWMinus = 0.5 * (vxR - cm) / (cm * cm) * (2.0 + vxR / cm)
+			+ 0.25 * (vxR - cm) * (vxR - cm) / (cm * cm * cm);
+		dcpWMinus = 0.75 * vxR * (cm - vxR) * (vxR + cm) / (cm * cm * cm * cm);
 	} else {
-		uMinus = 0.5 * (vxR - fabs(vxR));
-		pMinus = 0.5 * pR * (vxR - fabs(vxR)) / vxR;
+		uMinus = (vxR < 0.0 ? vxR : 0.0);
+		duMinus = (vxR < 0.0 ? 1.0 : 0.0);
+		pWMinus = (vxR < 0.0 ? 1.0 : 0.0);
+		dpWMinus = 0.0;
 	}
 
-	/* calculate AUSMD flux */
+	/* mass flux and pressure, and their derivatives */
 	double rhoU = uPlus * rhoL + uMinus * rhoR;
-	fluxLoc[0] = rhoU;
-	fluxLoc[1] = 0.5 * (rhoU * (vxR + vxL) - fabs(rhoU) * (vxR - vxL))
-			+ (pPlus + pMinus);
-	fluxLoc[2] = 0.5 * (rhoU * (vyR + vyL) - fabs(rhoU) * (vyR - vyL));
-	fluxLoc[3] = 0.5 * (rhoU * (HR + HL) - fabs(rhoU) * (HR - HL));
+	double dRhoUdWL[NVAR], dRhoUdWR[NVAR], dPdWL[NVAR], dPdWR[NVAR];
+	for (int j = 0; j < NVAR; ++j) {
+		double dRhoUdcm = rhoL * dcPlus + rhoR * dcMinus;
+		double dPdcm = pL * dcpWPlus + pR * dcpWMinus;
+
+		dRhoUdWL[j] = dRhoUdcm * dcmdWL[j] + (rhoL * daPlus * sR
+				- rhoR * daMinus * sR) * sSumQ2 * dsLdWL[j];
+		dRhoUdWR[j] = dRhoUdcm * dcmdWR[j] + (rhoR * daMinus * sL
+				- rhoL * daPlus * sL) * sSumQ2 * dsRdWR[j];
+		dPdWL[j] = dPdcm * dcmdWL[j];
+		dPdWR[j] = dPdcm * dcmdWR[j];
+	}
+	dRhoUdWL[RHO] += uPlus;
+	dRhoUdWL[VX]  += rhoL * duPlus;
+	dRhoUdWR[RHO] += uMinus;
+	dRhoUdWR[VX]  += rhoR * duMinus;
+	dPdWL[VX] += pL * dpWPlus;
+	dPdWL[P]  += pWPlus;
+	dPdWR[VX] += pR * dpWMinus;
+	dPdWR[P]  += pWMinus;
+
+	/* F = rhoU * (1, vx, vy, H) of the upwind side + pressure */
+	bool isLeft = (rhoU >= 0.0);
+	double *pVarK = isLeft ? pVarL : pVarR;
+	double rhoK = pVarK[RHO], vxK = pVarK[VX], vyK = pVarK[VY], pK = pVarK[P];
+	double psi[NVAR] = {1.0, vxK, vyK,
+			    gam * gam1q * pK / rhoK + 0.5 * (vxK * vxK + vyK * vyK)};
+	double dPsidW[NVAR][NVAR] = {
+		{0.0, 0.0, 0.0, 0.0},
+		{0.0, 1.0, 0.0, 0.0},
+		{0.0, 0.0, 1.0, 0.0},
+		{- gam * gam1q * pK / (rhoK * rhoK), vxK, vyK, gam * gam1q / rhoK}
+	};
+
+	double dFdWL[NVAR][NVAR], dFdWR[NVAR][NVAR];
+	for (int i = 0; i < NVAR; ++i) {
+		for (int j = 0; j < NVAR; ++j) {
+			dFdWL[i][j] = psi[i] * dRhoUdWL[j]
+				+ (isLeft ? rhoU * dPsidW[i][j] : 0.0);
+			dFdWR[i][j] = psi[i] * dRhoUdWR[j]
+				+ (isLeft ? 0.0 : rhoU * dPsidW[i][j]);
+		}
+	}
+	for (int j = 0; j < NVAR; ++j) {
+		dFdWL[1][j] += dPdWL[j];
+		dFdWR[1][j] += dPdWR[j];
+	}
+
+	double dWdUL[NVAR][NVAR], dWdUR[NVAR][NVAR];
+	consPrimJacobian(pVarL, dWdUL);
+	consPrimJacobian(pVarR, dWdUR);
+	for (int i = 0; i < NVAR; ++i) {
+		for (int j = 0; j < NVAR; ++j) {
+			dFdUL[i][j] = 0.0;
+			dFdUR[i][j] = 0.0;
+			for (int k = 0; k < NVAR; ++k) {
+				dFdUL[i][j] += dFdWL[i][k] * dWdUL[k][j];
+				dFdUR[i][j] += dFdWR[i][k] * dWdUR[k][j];
+			}
+		}
+	}
 }
 
 /**
- * \brief AUSMDV flux
- * \bug This function produces incorrect output, refrain from using it for the
- *	time being
- * \param[in] rhoL Left side density
- * \param[in] rhoR Right side density
- * \param[in] vxL Left side x-velocity
- * \param[in] vxR Right side x-velocity
- * \param[in] vyL Left side y-velocity
- * \param[in] vyR Right side y-velocity
- * \param[in] pL Left side pressure
- * \param[in] pR Right side pressure
- * \param[out] fluxLoc The local numeric flux
+ * \brief Jacobian of one part of the van Leer flux vector splitting
+ * \param[in] pVar Primitive state, rotated into normal direction
+ * \param[in] sign 1 for the positive part F+, -1 for the negative part F-
+ * \param[out] J The Jacobian dF+ / dU or dF- / dU
  */
-void flux_ausmdv(double rhoL, double rhoR,
-	         double vxL,  double vxR,
-	         double vyL,  double vyR,
-	         double pL,   double pR,
-	         double fluxLoc[4])
+void vanLeerSplitJacobian(double pVar[NVAR], double sign, double J[NVAR][NVAR])
 {
-	/* calculate left/right energy and enthalpy */
-	double eL = gam1q * pL + 0.5 * rhoL * (vxL * vxL + vyL * vyL);
-	double eR = gam1q * pR + 0.5 * rhoR * (vxR * vxR + vyR * vyR);
+	double rho = pVar[RHO], vx = pVar[VX], vy = pVar[VY], p = pVar[P];
+	double c = sqrt(gam * p / rho);
+	double M = vx / c;
+
+	if (sign * M >= 1.0) {
+		physicalFluxJacobian(pVar, J);
+		return;
+	} else if (sign * M <= - 1.0) {
+		memset(J, 0, sizeof(double[NVAR][NVAR]));
+		return;
+	}
 
-	double HL = (eL + pL) / rhoL;
-	double HR = (eR + pR) / rhoR;
+	/* subsonic split mass flux m and velocity term cx, and their
+	 * derivatives with respect to the primitive variables */
+	double vc = vx + sign * c;
+	double m = sign * 0.25 * rho * vc * vc / c;
+	double dm[NVAR] = {
+		sign * (0.25 * vc * vc / c - 0.125 * vc * (sign * c - vx) / c),
+		sign * 0.5 * rho * vc / c,
+		0.0,
+		sign * 0.125 * rho * vc * (sign * c - vx) / (c * p)
+	};
+	double cx = gam1 * vx + sign * 2.0 * c;
+	double dcx[NVAR] = {- sign * c / rho, gam1, 0.0, sign * c / p};
+	double cxFac = 1.0 / (gam * gam - 1.0);
+
+	double dFdW[NVAR][NVAR];
+	for (int j = 0; j < NVAR; ++j) {
+		dFdW[0][j] = dm[j];
+		dFdW[1][j] = (dm[j] * cx + m * dcx[j]) / gam;
+		dFdW[2][j] = dm[j] * vy;
+		dFdW[3][j] = 0.5 * dm[j] * (cx * cx * cxFac + vy * vy)
+			+ m * cx * dcx[j] * cxFac;
+	}
+	dFdW[2][VY] += m;
+	dFdW[3][VY] += m * vy;
+
+	double dWdU[NVAR][NVAR];
+	consPrimJacobian(pVar, dWdU);
+	for (int i = 0; i < NVAR; ++i) {
+		for (int j = 0; j < NVAR; ++j) {
+			J[i][j] = 0.0;
+			for (int k = 0; k < NVAR; ++k) {
+				J[i][j] += dFdW[i][k] * dWdU[k][j];
+			}
+		}
+	}
+}
 
-	/* maximum speed of sound */
-	double cL = sqrt(gam * pL / rhoL);
-	double cR = sqrt(gam * pR / rhoR);
-	double cm = fmax(cL, cR);
+/**
+ * \brief Jacobians of the van Leer flux
+ *
+ * As a flux vector splitting, the flux is the sum of a part depending only on
+ * the left state and one depending only on the right state, its Jacobians are
+ * exact.
+ *
+ * \param[in] pVarL Left side state, rotated into normal direction
+ * \param[in] pVarR Right side state, rotated into normal direction
+ * \param[out] dFdUL The Jacobian with respect to the left state
+ * \param[out] dFdUR The Jacobian with respect to the right state
+ */
+void flux_vanleer_jacobian(double pVarL[NVAR], double pVarR[NVAR],
+		double dFdUL[NVAR][NVAR], double dFdUR[NVAR][NVAR])
+{
+	vanLeerSplitJacobian(pVarL, 1.0, dFdUL);
+	vanLeerSplitJacobian(pVarR, - 1.0, dFdUR);
+}
 
-	double alphaL = 2.0 * pL / rhoL / (pL / rhoL + pR / rhoR);
-	double alphaR = 2.0 * pR / rhoR / (pL / rhoL + pR / rhoR);
+#ifdef navierstokes
+/**
+ * \brief Calculate the Jacobians of the diffusive flux in normal direction
+ *
+ * Only the compact part of the side gradients is taken into account, i.e.
+ * their dependence on the element states through the correction term, not
+ * through the gradients of the elements.
+ *
+ * \param[in] aSide A pointer to the side
+ * \param[in] state Mean primitive state of the two cells
+ * \param[in] gradX The x-gradient at the side
+ * \param[in] gradY The y-gradient at the side
+ * \param[out] dFdWL The Jacobian with respect to the left primitive state
+ * \param[out] dFdWR The Jacobian with respect to the right primitive state
+ */
+void diffusionFluxJacobian(side_t *aSide, double state[NVAR],
+		double gradX[NVAR], double gradY[NVAR],
+		double dFdWL[NVAR][NVAR], double dFdWR[NVAR][NVAR])
+{
+	double *n = sideData.n[aSide->id];
+	double ex = aSide->baryBaryVec[X] / aSide->baryBaryDist / aSide->baryBaryDist;
+	double ey = aSide->baryBaryVec[Y] / aSide->baryBaryDist / aSide->baryBaryDist;
+
+	/* the flux is linear in the gradients, which depend on the jump of the
+	 * states by (WR - WL) * (ex, ey) */
+	for (int j = 0; j < NVAR; ++j) {
+		double delGradX[NVAR] = {0.0}, delGradY[NVAR] = {0.0};
+		delGradX[j] = ex;
+		delGradY[j] = ey;
+
+		double f[NVAR] = {0.0}, g[NVAR] = {0.0};
+		diffusionFlux(state, delGradX, delGradY, f, g);
+		for (int i = 0; i < NVAR; ++i) {
+			dFdWR[i][j] =   f[i] * n[X] + g[i] * n[Y];
+			dFdWL[i][j] = - f[i] * n[X] - g[i] * n[Y];
+		}
+	}
 
-	double uPlus, pPlus;
-	if (fabs(vxL) < cm) {
-		pPlus = 0.25 * pL * (vxL + cm) * (vxL + cm) / (cm * cm) * (2.0 - vxL / cm);
-		if (vxL > 0.0) {
-			uPlus = vxL + alphaL * (vxL - cm) * (vxL - cm);
-		} else {
-			uPlus =       alphaL * (vxL + cm) * (vxL + cm);
+	/* dependence of the energy flux on the mean state */
+	double f[NVAR] = {0.0}, g[NVAR] = {0.0};
+	diffusionFlux(state, gradX, gradY, f, g);
+
+	double rho = state[RHO];
+	double heatFac = gam / (gam1 * Pr) * mu / (rho * rho);
+	double dStateE[NVAR] = {
+		heatFac * ((2.0 * state[P] / rho * gradX[RHO] - gradX[P]) * n[X]
+			 + (2.0 * state[P] / rho * gradY[RHO] - gradY[P]) * n[Y]),
+		f[MX] * n[X] + g[MX] * n[Y],
+		f[MY] * n[X] + g[MY] * n[Y],
+		- heatFac * (gradX[RHO] * n[X] + gradY[RHO] * n[Y])
+	};
+	for (int j = 0; j < NVAR; ++j) {
+		dFdWL[E][j] += 0.5 * dStateE[j];
+		dFdWR[E][j] += 0.5 * dStateE[j];
+	}
+}
+#endif
+
+/**
+ * \brief Rotate a flux Jacobian from the normal system of a side into the
+ *	global coordinate system
+ * \param[in] n Normal vector of the side
+ * \param[in,out] J The Jacobian, dF / dU in the normal system on input
+ */
+void rotateJacobian(double n[NDIM], double J[NVAR][NVAR])
+{
+	/* transform the momentum columns, J * T */
+	for (int i = 0; i < NVAR; ++i) {
+		double jx = J[i][MX], jy = J[i][MY];
+		J[i][MX] = n[X] * jx - n[Y] * jy;
+		J[i][MY] = n[Y] * jx + n[X] * jy;
+	}
+
+	/* transform the momentum rows, T^T * (J * T) */
+	for (int j = 0; j < NVAR; ++j) {
+		double jx = J[MX][j], jy = J[MY][j];
+		J[MX][j] = n[X] * jx - n[Y] * jy;
+		J[MY][j] = n[Y] * jx + n[X] * jy;
+	}
+}
+
+/**
+ * \brief Calculate the Jacobian of the ghost state of a BC face with respect
+ *	to the inner state
+ *
+ * The boundary conditions are given as functions of the inner primitive
+ * state, they are differentiated by perturbing it. This is exact for the
+ * linear boundary conditions, like walls or prescribed states.
+ *
+ * \param[in] gSide A pointer to the ghost side
+ * \param[in] time Calculation time
+ * \param[in] pVarInner The primitive state at the inner side
+ * \param[in] pVarGhost The primitive state at the ghost side
+ * \param[out] dUgdUi The Jacobian dU_ghost / dU_inner
+ */
+void ghostJacobian(side_t *gSide, double time, double pVarInner[NVAR],
+		double pVarGhost[NVAR], double dUgdUi[NVAR][NVAR])
+{
+	double dWgdWi[NVAR][NVAR];
+	for (int j = 0; j < NVAR; ++j) {
+		double pVarPert[NVAR] = {
+			pVarInner[RHO], pVarInner[VX], pVarInner[VY], pVarInner[P]
+		};
+		double eps = rEps0 * (1.0 + fabs(pVarInner[j]));
+		pVarPert[j] += eps;
+
+		double pVarGhostPert[NVAR];
+		ghostState(gSide, time, pVarPert, pVarGhostPert);
+		for (int i = 0; i < NVAR; ++i) {
+			dWgdWi[i][j] = (pVarGhostPert[i] - pVarGhost[i]) / eps;
 		}
-	} else {
-		if (vxL > 0.0) {
-			uPlus = vxL;
-			pPlus = pL;
-		} else {
-			uPlus = 0.0;
-			pPlus = 0.0;
+	}
+
+	double dUdW[NVAR][NVAR], dWdU[NVAR][NVAR];
+	primConsJacobian(pVarGhost, dUdW);
+	consPrimJacobian(pVarInner, dWdU);
+
+	double tmp[NVAR][NVAR];
+	for (int i = 0; i < NVAR; ++i) {
+		for (int j = 0; j < NVAR; ++j) {
+			tmp[i][j] = 0.0;
+			for (int k = 0; k < NVAR; ++k) {
+				tmp[i][j] += dWgdWi[i][k] * dWdU[k][j];
+			}
 		}
 	}
+	for (int i = 0; i < NVAR; ++i) {
+		for (int j = 0; j < NVAR; ++j) {
+			dUgdUi[i][j] = 0.0;
+			for (int k = 0; k < NVAR; ++k) {
+				dUgdUi[i][j] += dUdW[i][k] * tmp[k][j];
+			}
+		}
+	}
+}
 
-	double uMinus, pMinus;
-	if (fabs(vxR) < cm) {
-		pMinus = 0.25 * pR * (vxR - cm) * (vxR - cm) / (cm * cm) * (2.0 + vxR / cm);
-		if (vxR > 0.0) {
-			uMinus =     - alphaR * (vxL - cm) * (vxL - cm);
-		} else {
-			uMinus = vxR - alphaR * (vxR + cm) * (vxR + cm);
+/**
+ * \brief Calculate the Jacobians of the integrated flux over a face
+ *
+ * The side states are treated as the states of the elements, which is exact
+ * for first order and neglects the reconstruction otherwise. At BC faces the
+ * dependence of the ghost state on the inner state is added to the Jacobian of
+ * the inner element, the one of the ghost element is zero.
+ *
+ * \param[in] aSide A pointer to the side of the face listed in `side`
+ * \param[in] time Calculation time
+ * \param[out] dFdUL The Jacobian with respect to the state of the element of
+ *	`aSide`
+ * \param[out] dFdUR The Jacobian with respect to the state of the element of
+ *	the connection of `aSide`
+ */
+void faceJacobian(side_t *aSide, double time, double dFdUL[NVAR][NVAR],
+		double dFdUR[NVAR][NVAR])
+{
+	double *n = sideData.n[aSide->id];
+
+	double pVarL[NVAR], pVarR[NVAR];
+	faceStates(aSide, time, pVarL, pVarR);
+
+	/* convective part, in the normal system of the side */
+	double pVarLocL[NVAR] = {
+		pVarL[RHO],
+		  n[X] * pVarL[VX] + n[Y] * pVarL[VY],
+		- n[Y] * pVarL[VX] + n[X] * pVarL[VY],
+		pVarL[P]
+	};
+	double pVarLocR[NVAR] = {
+		pVarR[RHO],
+		  n[X] * pVarR[VX] + n[Y] * pVarR[VY],
+		- n[Y] * pVarR[VX] + n[X] * pVarR[VY],
+		pVarR[P]
+	};
+	fluxJacobian(pVarLocL, pVarLocR, dFdUL, dFdUR);
+	rotateJacobian(n, dFdUL);
+	rotateJacobian(n, dFdUR);
+
+	#ifdef navierstokes
+	/* diffusive part, which is subtracted from the flux */
+	double stateMean[NVAR] = {
+		0.5 * (pVarR[RHO] + pVarL[RHO]),
+		0.5 * (pVarR[VX]  + pVarL[VX]),
+		0.5 * (pVarR[VY]  + pVarL[VY]),
+		0.5 * (pVarR[P]   + pVarL[P])
+	};
+	double gradUx[NVAR], gradUy[NVAR];
+	sideGradients(aSide, gradUx, gradUy);
+
+	double dFdWL[NVAR][NVAR], dFdWR[NVAR][NVAR];
+	diffusionFluxJacobian(aSide, stateMean, gradUx, gradUy, dFdWL, dFdWR);
+
+	double dWdUL[NVAR][NVAR], dWdUR[NVAR][NVAR];
+	consPrimJacobian(pVarL, dWdUL);
+	consPrimJacobian(pVarR, dWdUR);
+	for (int i = 0; i < NVAR; ++i) {
+		for (int j = 0; j < NVAR; ++j) {
+			for (int k = 0; k < NVAR; ++k) {
+				dFdUL[i][j] -= dFdWL[i][k] * dWdUL[k][j];
+				dFdUR[i][j] -= dFdWR[i][k] * dWdUR[k][j];
+			}
 		}
-	} else {
-		if (vxR > 0.0) {
-			uMinus = 0.0;
-			pMinus = 0.0;
-		} else {
-			uMinus = vxR;
-			pMinus = pR;
+	}
+	#endif
+
+	/* fold the boundary condition into the Jacobian of the inner element */
+	side_t *bSide = aSide->connection;
+	double (*dFdUi)[NVAR] = NULL, (*dFdUg)[NVAR] = NULL;
+	double dUgdUi[NVAR][NVAR];
+	if (aSide->elem - elemBlock >= nElems) {
+		ghostJacobian(aSide, time, pVarR, pVarL, dUgdUi);
+		dFdUi = dFdUR;
+		dFdUg = dFdUL;
+	} else if (bSide->elem - elemBlock >= nElems) {
+		ghostJacobian(bSide, time, pVarL, pVarR, dUgdUi);
+		dFdUi = dFdUL;
+		dFdUg = dFdUR;
+	}
+
+	if (dFdUg) {
+		for (int i = 0; i < NVAR; ++i) {
+			for (int j = 0; j < NVAR; ++j) {
+				for (int k = 0; k < NVAR; ++k) {
+					dFdUi[i][j] += dFdUg[i][k] * dUgdUi[k][j];
+				}
+			}
 		}
+		memset(dFdUg, 0, sizeof(double[NVAR][NVAR]));
 	}
 
-	/* calculate AUSMDV flux */
-	double rhoU = uPlus * rhoL + uMinus * rhoR;
+	/* integrate over the side using the midpoint rule */
+	double len = sideData.len[aSide->id];
+	for (int i = 0; i < NVAR; ++i) {
+		for (int j = 0; j < NVAR; ++j) {
+			dFdUL[i][j] *= len;
+			dFdUR[i][j] *= len;
+		}
+	}
+}
 
-	double s = fmin(1.0, 10.0 * fabs(pR - pL) / fmin(pR, pL));
-	double rhoUsq = 0.5 * (1.0 + s) * (rhoL * vxL * uPlus + rhoR * vxR * uMinus);
-	rhoUsq += 0.25 * (1.0 - s) * (rhoU * (vxR + vxL) - fabs(rhoU) * (vxR - vxL));
+/**
+ * \brief Color the face blocks, such that no two blocks of the same color
+ *	share an element
+ *
+ * The colors of the blocks touching an element are stored as a bit mask per
+ * element, every block gets the lowest color not used by any of its elements.
+ *
+ * \param[in] blockSize Number of faces per block
+ * \param[out] blockColor The color of every block
+ * \return True if at most `MAX_FACE_COLORS` colors are needed
+ */
+bool colorFaceBlocks(long blockSize, long *blockColor)
+{
+	uint64_t *elemColors = calloc(elemData.nElems, sizeof(uint64_t));
+	if (!elemColors) {
+		printf("| ERROR: could not allocate elemColors\n");
+		exit(1);
+	}
 
-	fluxLoc[0] = rhoU;
-	fluxLoc[1] = rhoUsq + (pPlus + pMinus);
-	fluxLoc[2] = 0.5 * (rhoU * (vyR + vyL) - fabs(rhoU) * (vyR - vyL));
-	fluxLoc[3] = 0.5 * (rhoU * (HR + HL) - fabs(rhoU) * (HR - HL));
+	long nBlocks = (nSides + blockSize - 1) / blockSize;
+	nFaceColors = 0;
+	for (long iBlock = 0; iBlock < nBlocks; ++iBlock) {
+		long iEnd = ((iBlock + 1) * blockSize < nSides ?
+				(iBlock + 1) * blockSize : nSides);
 
-	/* entropy fix */
-	bool tmpa = (vxL - cL < 0.0) && (vxR - cR > 0.0);
-	bool tmpb = (vxL + cL < 0.0) && (vxR + cR > 0.0);
-	double tmpL[4] = {1.0, vxL, vyL, HL};
-	double tmpR[4] = {1.0, vxR, vyR, HR};
-	if (tmpa && !tmpb) {
-		fluxLoc[0] -= 0.125 * ((vxR - cR) - (vxL - cL)) * (rhoR * tmpR[0] - rhoL * tmpL[0]);
-		fluxLoc[1] -= 0.125 * ((vxR - cR) - (vxL - cL)) * (rhoR * tmpR[1] - rhoL * tmpL[1]);
-		fluxLoc[2] -= 0.125 * ((vxR - cR) - (vxL - cL)) * (rhoR * tmpR[2] - rhoL * tmpL[2]);
-		fluxLoc[3] -= 0.125 * ((vxR - cR) - (vxL - cL)) * (rhoR * tmpR[3] - rhoL * tmpL[3]);
-	}
-	if (!tmpa && tmpb) {
-		fluxLoc[0] -= 0.125 * ((vxR + cR) - (vxL + cL)) * (rhoR * tmpR[0] - rhoL * tmpL[0]);
-		fluxLoc[1] -= 0.125 * ((vxR + cR) - (vxL + cL)) * (rhoR * tmpR[1] - rhoL * tmpL[1]);
-		fluxLoc[2] -= 0.125 * ((vxR + cR) - (vxL + cL)) * (rhoR * tmpR[2] - rhoL * tmpL[2]);
-		fluxLoc[3] -= 0.125 * ((vxR + cR) - (vxL + cL)) * (rhoR * tmpR[3] - rhoL * tmpL[3]);
+		uint64_t usedColors = 0;
+		for (long iSide = iBlock * blockSize; iSide < iEnd; ++iSide) {
+			usedColors |= elemColors[side[iSide]->elem - elemBlock];
+			usedColors |= elemColors[side[iSide]->connection->elem - elemBlock];
+		}
+
+		long iColor = 0;
+		while ((iColor < MAX_FACE_COLORS) && (usedColors & ((uint64_t)1 << iColor))) {
+			iColor++;
+		}
+
+		if (iColor == MAX_FACE_COLORS) {
+			free(elemColors);
+			return false;
+		}
+
+		for (long iSide = iBlock * blockSize; iSide < iEnd; ++iSide) {
+			elemColors[side[iSide]->elem - elemBlock] |= (uint64_t)1 << iColor;
+			elemColors[side[iSide]->connection->elem - elemBlock] |= (uint64_t)1 << iColor;
+		}
+
+		blockColor[iBlock] = iColor;
+		if (iColor >= nFaceColors) {
+			nFaceColors = iColor + 1;
+		}
 	}
+
+	free(elemColors);
+	return true;
 }
 
 /**
- * \brief Van Leer flux
- * \param[in] rhoL Left side density
- * \param[in] rhoR Right side density
- * \param[in] vxL Left side x-velocity
- * \param[in] vxR Right side x-velocity
- * \param[in] vyL Left side y-velocity
- * \param[in] vyR Right side y-velocity
- * \param[in] pL Left side pressure
- * \param[in] pR Right side pressure
- * \param[out] fluxLoc The local numeric flux
+ * \brief The flux functions for a batch of sides, indexed by flux function
  */
-void flux_vanleer(double rhoL, double rhoR,
-	          double vxL,  double vxR,
-	          double vyL,  double vyR,
-	          double pL,   double pR,
-	          double fluxLoc[4])
+#define FLUX_BATCH_ENTRY(ID, name) [ID] = flux_##name##_batch,
+void (*fluxBatches[])(int nBatch, double pVarL[NVAR][FLUX_BATCH],
+		double pVarR[NVAR][FLUX_BATCH], double fluxLoc[NVAR][FLUX_BATCH]) = {
+	FLUX_FUNCTIONS(FLUX_BATCH_ENTRY)
+};
+#undef FLUX_BATCH_ENTRY
+
+/**
+ * \brief Group the faces into blocks of consecutive faces and color them
+ *
+ * The fluxes of a face are scattered into both adjacent elements, the blocks
+ * of one color can thus be processed in parallel. The block size is halved
+ * until the blocks can be colored, which is guaranteed for blocks of
+ * `FLUX_BATCH` faces, as every element has at most four sides.
+ */
+void initFluxCalculation(void)
 {
-	/* calculate speed of sound */
-	double cL = sqrt(gam * pL / rhoL);
-	double cR = sqrt(gam * pR / rhoR);
+	long *blockColor = malloc(((nSides + FLUX_BATCH - 1) / FLUX_BATCH) * sizeof(long));
+	if (!blockColor) {
+		printf("| ERROR: could not allocate blockColor\n");
+		exit(1);
+	}
 
-	/* calculate left/right energy and enthalpy */
-	double eL = gam1q * pL + 0.5 * rhoL * (vxL * vxL + vyL * vyL);
-	double eR = gam1q * pR + 0.5 * rhoR * (vxR * vxR + vyR * vyR);
-
-	double HL = (eL + pL) / rhoL;
-	double HR = (eR + pR) / rhoR;
-
-	/* positive flux from left to right */
-	double fp[4], ML = vxL / cL;
-	if (ML > 1.0) {
-		fp[0] = rhoL * vxL;
-		fp[1] = fp[0] * vxL + pL;
-		fp[2] = fp[0] * vyL;
-		fp[3] = fp[0] * HL;
-	} else if ((ML < 1.0) && (ML > - 1.0)) {
-		double cx = gam1 * vxL + 2.0 * cL;
-		fp[0] = 0.25 * rhoL * cL * (ML + 1.0) * (ML + 1.0);
-		fp[1] = fp[0] * cx / gam;
-		fp[2] = fp[0] * vyL;
-		fp[3] = 0.5 * (fp[1] * cx * gam / (gam * gam - 1.0) + fp[2] * vyL);
-	} else {
-		fp[0] = 0.0;
-		fp[1] = 0.0;
-		fp[2] = 0.0;
-		fp[3] = 0.0;
-	}
-
-	/* negative flux from right to left */
-	double fm[4], MR = vxR / cR;
-	if (MR < - 1.0) {
-		fm[0] = rhoR * vxR;
-		fm[1] = fm[0] * vxR + pR;
-		fm[2] = fm[0] * vyR;
-		fm[3] = fm[0] * HR;
-	} else if ((MR < 1.0) && (MR > - 1.0)) {
-		double cx = gam1 * vxR - 2.0 * cR;
-		fm[0] = - 0.25 * rhoR * cR * (1.0 - MR) * (1.0 - MR);
-		fm[1] = fm[0] * cx / gam;
-		fm[2] = fm[0] * vyR;
-		fm[3] = 0.5 * (fm[1] * cx * gam / (gam * gam - 1.0) + fm[2] * vyR);
-	} else {
-		fm[0] = 0.0;
-		fm[1] = 0.0;
-		fm[2] = 0.0;
-		fm[3] = 0.0;
+	int nThreads = 1;
+	#ifdef _OPENMP
+	nThreads = omp_get_max_threads();
+	#endif
+
+	/* large blocks keep the element data in cache, but every thread needs
+	 * several blocks to work on */
+	faceBlockSize = FACE_BLOCK;
+	while ((faceBlockSize > FLUX_BATCH) && (nSides < 8 * nThreads * faceBlockSize)) {
+		faceBlockSize /= 2;
+	}
+
+	while (!colorFaceBlocks(faceBlockSize, blockColor)) {
+		if (faceBlockSize == FLUX_BATCH) {
+			printf("| ERROR: could not color the face blocks\n");
+			exit(1);
+		}
+		faceBlockSize /= 2;
+	}
+
+	/* sort the blocks by color */
+	long nBlocks = (nSides + faceBlockSize - 1) / faceBlockSize;
+	colorBlockStart = calloc(nFaceColors + 1, sizeof(long));
+	colorBlock = malloc(nBlocks * sizeof(long));
+	if (!colorBlockStart || !colorBlock) {
+		printf("| ERROR: could not allocate colorBlock\n");
+		exit(1);
+	}
+
+	for (long iBlock = 0; iBlock < nBlocks; ++iBlock) {
+		colorBlockStart[blockColor[iBlock] + 1]++;
 	}
 
-	/* calculate van Leer flux */
-	fluxLoc[0] = fp[0] + fm[0];
-	fluxLoc[1] = fp[1] + fm[1];
-	fluxLoc[2] = fp[2] + fm[2];
-	fluxLoc[3] = fp[3] + fm[3];
+	for (long iColor = 0; iColor < nFaceColors; ++iColor) {
+		colorBlockStart[iColor + 1] += colorBlockStart[iColor];
+	}
+
+	long *colorPos = malloc(nFaceColors * sizeof(long));
+	if (!colorPos) {
+		printf("| ERROR: could not allocate colorPos\n");
+		exit(1);
+	}
+
+	memcpy(colorPos, colorBlockStart, nFaceColors * sizeof(long));
+	for (long iBlock = 0; iBlock < nBlocks; ++iBlock) {
+		colorBlock[colorPos[blockColor[iBlock]]++] = iBlock;
+	}
+
+	printf("| Face Blocks: %ld blocks of %ld faces in %ld colors\n",
+			nBlocks, faceBlockSize, nFaceColors);
+
+	fluxBatch = fluxBatches[iFlux];
+
+	free(colorPos);
+	free(blockColor);
 }
 
 /**
- * \brief Select the convective flux
- * \param[in] rhoL Left side density
- * \param[in] rhoR Right side density
- * \param[in] vxL Left side x-velocity
- * \param[in] vxR Right side x-velocity
- * \param[in] vyL Left side y-velocity
- * \param[in] vyR Right side y-velocity
- * \param[in] pL Left side pressure
- * \param[in] pR Right side pressure
- * \param[out] fluxLoc The local numeric flux
+ * \brief Free the face block coloring
  */
-void convectiveFlux(double rhoL, double rhoR,
-		    double vxL,  double vxR,
-		    double vyL,  double vyR,
-		    double pL,   double pR,
-		    double fluxLoc[4])
+void freeFluxCalculation(void)
 {
-	switch (iFlux) {
-	case GOD:
-		flux_god(rhoL, rhoR, vxL, vxR, vyL, vyR, pL, pR, fluxLoc);
-		break;
-	case ROE:
-		flux_roe(rhoL, rhoR, vxL, vxR, vyL, vyR, pL, pR, fluxLoc);
-		break;
-	case HLL:
-		flux_hll(rhoL, rhoR, vxL, vxR, vyL, vyR, pL, pR, fluxLoc);
-		break;
-	case HLLE:
-		flux_hlle(rhoL, rhoR, vxL, vxR, vyL, vyR, pL, pR, fluxLoc);
-		break;
-	case HLLC:
-		flux_hllc(rhoL, rhoR, vxL, vxR, vyL, vyR, pL, pR, fluxLoc);
-		break;
-	case LXF:
-		flux_lxf(rhoL, rhoR, vxL, vxR, vyL, vyR, pL, pR, fluxLoc);
-		break;
-	case STW:
-		flux_stw(rhoL, rhoR, vxL, vxR, vyL, vyR, pL, pR, fluxLoc);
-		break;
-	case CEN:
-		flux_cen(rhoL, rhoR, vxL, vxR, vyL, vyR, pL, pR, fluxLoc);
-		break;
-	case AUSMD:
-		flux_ausmd(rhoL, rhoR, vxL, vxR, vyL, vyR, pL, pR, fluxLoc);
-		break;
-	case AUSMDV:
-		flux_ausmdv(rhoL, rhoR, vxL, vxR, vyL, vyR, pL, pR, fluxLoc);
-		break;
-	case VANLEER:
-		flux_vanleer(rhoL, rhoR, vxL, vxR, vyL, vyR, pL, pR, fluxLoc);
-		break;
-	}
+	free(colorBlockStart);
+	free(colorBlock);
 }
 
-#ifdef navierstokes
 /**
- * \brief Calculate the diffusive flux
- * \param[in] state Mean conservative state of the two cells
- * \param[in] gradX The x-gradient at the side
- * \param[in] gradY The y-gradient at the side
- * \param[out] f Diffusive flux in x-direction
- * \param[out] g Diffusive flux in y-direction
+ * \brief Jacobians of the flux functions, the flux functions without one are
+ *	left empty
  */
-void diffusionFlux(double state[NVAR], double gradX[NVAR], double gradY[NVAR],
-		double f[NVAR], double g[NVAR])
+void (*fluxJacobians[])(double pVarL[NVAR], double pVarR[NVAR],
+		double dFdUL[NVAR][NVAR], double dFdUR[NVAR][NVAR]) = {
+	[ROE] = flux_roe_jacobian,
+	[HLL] = flux_hll_jacobian,
+	[HLLE] = flux_hlle_jacobian,
+	[HLLC] = flux_hllc_jacobian,
+	[LXF] = flux_lxf_jacobian,
+	[CEN] = flux_cen_jacobian,
+	[AUSMD] = flux_ausmd_jacobian,
+	[VANLEER] = flux_vanleer_jacobian
+};
+
+/**
+ * \brief Select the Jacobians of the flux function
+ */
+void initFluxJacobian(void)
 {
-	/* f[RHO] = 0.0; */
-	f[MX]  = (4.0 / 3.0 * gradX[MX] - 2.0 / 3.0 * gradY[MY]) * mu;
-	f[MY]  = (gradY[MX] + gradX[MY]) * mu;
-	f[E]   = (4.0 / 3.0 * state[MX] * gradX[MX] - 2.0 / 3.0 * state[MX] * gradY[MY]
-		+ (gradX[MY] + gradY[MX]) * state[MY]
-		+ gam / (gam1 * Pr * state[RHO] * state[RHO])
-		* (state[RHO] * gradX[P] - state[P] * gradX[RHO])) * mu;
-
-	/* g[RHO] = 0.0; */
-	g[MX]  = (gradY[MX] + gradX[MY]) * mu;
-	g[MY]  = (4.0 / 3.0 * gradY[MY] - 2.0 / 3.0 * gradX[MX]) * mu;
-	g[E]   = (4.0 / 3.0 * state[MY] * gradY[MY] - 2.0 / 3.0 * state[MY] * gradX[MX]
-		+ (gradY[MX] + gradX[MY]) * state[MX]
-		+ gam / (gam1 * Pr * state[RHO] * state[RHO])
-		* (state[RHO] * gradY[P] - state[P] * gradY[RHO])) * mu;
+	fluxJacobian = fluxJacobians[iFlux];
+	if (!fluxJacobian) {
+		printf("| ERROR: no analytic Jacobian for flux function %d\n", iFlux);
+		exit(1);
+	}
 }
-#endif
 
-/** \brief Perform the flux calculation
+/**
+ * \brief Calculate the flux Jacobians of all faces in one sweep
+ *
+ * The face blocks of one color are processed in parallel, as for the fluxes,
+ * so that the Jacobians of a face can be added to the rows of both adjacent
+ * elements without conflicts.
  *
- * Calculation of left and right state, the velocity vector is transformed into
- * the normal system of the cell interfaces. The function finishes with a
- * back rotation of the velocity vector into global coordinate system.
+ * \param[in] time Calculation time
+ * \param[in] addFaceJacobian Function adding the Jacobians of the integrated
+ *	flux over a face to its elements
  */
-void fluxCalculation(void)
+void fluxJacobianCalculation(double time, void (*addFaceJacobian)(side_t *aSide,
+		double dFdUL[NVAR][NVAR], double dFdUR[NVAR][NVAR]))
 {
-	#pragma omp parallel for
-	for (long iSide = 0; iSide < nSides; ++iSide) {
-		side_t *aSide = side[iSide];
-
-		/* extract left state */
-		double pVar[NVAR];
-		pVar[RHO] = aSide->pVar[RHO];
-		pVar[VX]  = aSide->pVar[VX];
-		pVar[VY]  = aSide->pVar[VY];
-		pVar[P]   = aSide->pVar[P];
-
-		/* rotate it into normal direction */
-		double pVarL[NVAR];
-		pVarL[RHO] = pVar[RHO];
-		pVarL[VX]  =   aSide->n[X] * pVar[VX] + aSide->n[Y] * pVar[VY];
-		pVarL[VY]  = - aSide->n[Y] * pVar[VX] + aSide->n[X] * pVar[VY];
-		pVarL[P]   = pVar[P];
-
-		/* extract right state */
-		pVar[RHO] = aSide->connection->pVar[RHO];
-		pVar[VX]  = aSide->connection->pVar[VX];
-		pVar[VY]  = aSide->connection->pVar[VY];
-		pVar[P]   = aSide->connection->pVar[P];
-
-		/* rotate it into normal direction */
-		double pVarR[NVAR];
-		pVarR[RHO] = pVar[RHO];
-		pVarR[VX]  =   aSide->n[X] * pVar[VX] + aSide->n[Y] * pVar[VY];
-		pVarR[VY]  = - aSide->n[Y] * pVar[VX] + aSide->n[X] * pVar[VY];
-		pVarR[P]   = pVar[P];
-
-		#ifdef navierstokes
-		/* extract left and right gradients */
-		double stateMean[NVAR] = {
-			0.5 * (aSide->connection->pVar[RHO] + aSide->pVar[RHO]),
-			0.5 * (aSide->connection->pVar[VX]  + aSide->pVar[VX]),
-			0.5 * (aSide->connection->pVar[VY]  + aSide->pVar[VY]),
-			0.5 * (aSide->connection->pVar[P]   + aSide->pVar[P])
-		};
-		double gradUxMean[NVAR] = {
-			0.5 * (aSide->elem->u_x[RHO] + aSide->connection->elem->u_x[RHO]),
-			0.5 * (aSide->elem->u_x[VX]  + aSide->connection->elem->u_x[VX]),
-			0.5 * (aSide->elem->u_x[VY]  + aSide->connection->elem->u_x[VY]),
-			0.5 * (aSide->elem->u_x[P]   + aSide->connection->elem->u_x[P])
-		};
-		double gradUyMean[NVAR] = {
-			0.5 * (aSide->elem->u_y[RHO] + aSide->connection->elem->u_y[RHO]),
-			0.5 * (aSide->elem->u_y[VX]  + aSide->connection->elem->u_y[VX]),
-			0.5 * (aSide->elem->u_y[VY]  + aSide->connection->elem->u_y[VY]),
-			0.5 * (aSide->elem->u_y[P]   + aSide->connection->elem->u_y[P])
-		};
-		double baryBary[NDIM] = {
-			aSide->baryBaryVec[X] / aSide->baryBaryDist,
-			aSide->baryBaryVec[Y] / aSide->baryBaryDist
-		};
-		double correction[NVAR] = {
-			gradUxMean[RHO] * baryBary[X] + gradUyMean[RHO] * baryBary[Y] - (aSide->connection->elem->pVar[RHO] - aSide->elem->pVar[RHO]) / aSide->baryBaryDist,
-			gradUxMean[VX]  * baryBary[X] + gradUyMean[VX]  * baryBary[Y] - (aSide->connection->elem->pVar[VX]  - aSide->elem->pVar[VX])  / aSide->baryBaryDist,
-			gradUxMean[VY]  * baryBary[X] + gradUyMean[VY]  * baryBary[Y] - (aSide->connection->elem->pVar[VY]  - aSide->elem->pVar[VY])  / aSide->baryBaryDist,
-			gradUxMean[P]   * baryBary[X] + gradUyMean[P]   * baryBary[Y] - (aSide->connection->elem->pVar[P]   - aSide->elem->pVar[P])   / aSide->baryBaryDist
-		};
-		double gradUx[NVAR] = {
-			gradUxMean[RHO] - correction[RHO] * baryBary[X],
-			gradUxMean[VX]  - correction[VX]  * baryBary[X],
-			gradUxMean[VY]  - correction[VY]  * baryBary[X],
-			gradUxMean[P]   - correction[P]   * baryBary[X]
-		};
-		double gradUy[NVAR] = {
-			gradUyMean[RHO] - correction[RHO] * baryBary[Y],
-			gradUyMean[VX]  - correction[VX]  * baryBary[Y],
-			gradUyMean[VY]  - correction[VY]  * baryBary[Y],
-			gradUyMean[P]   - correction[P]   * baryBary[Y]
-		};
-		#endif
-
-		/* calculate flux */
-		double fluxConv[4] = {0.0};
-		convectiveFlux(pVarL[RHO], pVarR[RHO],
-			       pVarL[VX],  pVarR[VX],
-			       pVarL[VY],  pVarR[VY],
-			       pVarL[P],   pVarR[P],
-			       fluxConv);
-
-		#ifdef navierstokes
-		double fluxDiffX[4] = {0.0}, fluxDiffY[4] = {0.0};
-		diffusionFlux(stateMean, gradUx, gradUy, fluxDiffX, fluxDiffY);
-		#endif
-
-		/* rotate flux into global coordinate system and update residual */
-		aSide->flux[RHO] = fluxConv[RHO];
-		aSide->flux[MX]  = aSide->n[X] * fluxConv[MX] - aSide->n[Y] * fluxConv[MY];
-		aSide->flux[MY]  = aSide->n[Y] * fluxConv[MX] + aSide->n[X] * fluxConv[MY];
-		aSide->flux[E]   = fluxConv[E];
-
-		#ifdef navierstokes
-		/* sum up diffusion part of the fluxes */
-		aSide->flux[RHO] -= (fluxDiffX[RHO] * aSide->n[X] + fluxDiffY[RHO] * aSide->n[Y]);
-		aSide->flux[MX]  -= (fluxDiffX[MX]  * aSide->n[X] + fluxDiffY[MX]  * aSide->n[Y]);
-		aSide->flux[MY]  -= (fluxDiffX[MY]  * aSide->n[X] + fluxDiffY[MY]  * aSide->n[Y]);
-		aSide->flux[E]   -= (fluxDiffX[E]   * aSide->n[X] + fluxDiffY[E]   * aSide->n[Y]);
-		#endif
-
-		/* integrate flux over edge using the midpoint rule */
-		aSide->flux[RHO] *= aSide->len;
-		aSide->flux[MX]  *= aSide->len;
-		aSide->flux[MY]  *= aSide->len;
-		aSide->flux[E]   *= aSide->len;
-
-		/* set flux of connection cell */
-		aSide->connection->flux[RHO] = - aSide->flux[RHO];
-		aSide->connection->flux[MX]  = - aSide->flux[MX];
-		aSide->connection->flux[MY]  = - aSide->flux[MY];
-		aSide->connection->flux[E]   = - aSide->flux[E];
+	#pragma omp parallel
+	for (long iColor = 0; iColor < nFaceColors; ++iColor) {
+		#pragma omp for
+		for (long k = colorBlockStart[iColor]; k < colorBlockStart[iColor + 1]; ++k) {
+			long iBlock = colorBlock[k];
+			long iEnd = ((iBlock + 1) * faceBlockSize < nSides ?
+					(iBlock + 1) * faceBlockSize : nSides);
+			for (long iSide = iBlock * faceBlockSize; iSide < iEnd; ++iSide) {
+				double dFdUL[NVAR][NVAR], dFdUR[NVAR][NVAR];
+				faceJacobian(side[iSide], time, dFdUL, dFdUR);
+				addFaceJacobian(side[iSide], dFdUL, dFdUR);
+			}
+		}
 	}
 }
@@ -7,6 +7,55 @@
 #ifndef FLUXCALCULATION_H
 #define FLUXCALCULATION_H
 
-void fluxCalculation(void);
+#include "main.h"
+#include "mesh.h"
+
+#define FLUX_BATCH 8		/**< number of sides per flux batch */
+
+/**
+ * \brief List of the flux functions as pairs of enum and function name
+ *
+ * Each entry expands to a specialized flux calculation
+ * `fluxCalculation_<name>`.
+ */
+#define FLUX_FUNCTIONS(X) \
+	X(GOD, god) \
+	DUAL_FLUX_FUNCTIONS(X)
+
+/**
+ * \brief List of the flux functions which are also compiled for dual numbers,
+ *	as `fluxCalculation_<name>Dual`
+ *
+ * The exact Riemann solver of the Godunov flux iterates on the pressure, it
+ * is left out.
+ */
+#define DUAL_FLUX_FUNCTIONS(X) \
+	X(ROE, roe) \
+	X(HLL, hll) \
+	X(HLLE, hlle) \
+	X(HLLC, hllc) \
+	X(LXF, lxf) \
+	X(STW, stw) \
+	X(CEN, cen) \
+	X(AUSMD, ausmd) \
+	X(AUSMDV, ausmdv) \
+	X(VANLEER, vanleer)
+
+extern void (*fluxBatch)(int nBatch, double pVarL[NVAR][FLUX_BATCH],
+		double pVarR[NVAR][FLUX_BATCH], double fluxLoc[NVAR][FLUX_BATCH]);
+
+void initFluxCalculation(void);
+void freeFluxCalculation(void);
+void initFluxJacobian(void);
+void fluxJacobianCalculation(double time, void (*addFaceJacobian)(side_t *aSide,
+		double dFdUL[NVAR][NVAR], double dFdUR[NVAR][NVAR]));
+
+#define FLUX_CALCULATION_PROTOTYPE(ID, name) void fluxCalculation_##name(double time);
+FLUX_FUNCTIONS(FLUX_CALCULATION_PROTOTYPE)
+#undef FLUX_CALCULATION_PROTOTYPE
+
+#define FLUX_CALCULATION_DUAL_PROTOTYPE(ID, name) void fluxCalculation_##name##Dual(double time);
+DUAL_FLUX_FUNCTIONS(FLUX_CALCULATION_DUAL_PROTOTYPE)
+#undef FLUX_CALCULATION_DUAL_PROTOTYPE
 
 #endif
@@ -0,0 +1,1145 @@
+/** \file
+ *
+ * \brief Flux function and flux balance kernels, compiled for double values
+ *	and for dual numbers, see scalar.h
+ *
+ * \author hhh
+ * \date Sun 18 Oct 2026 06:41:09 PM CEST
+ */
+
+typedef struct NAME(fluxBatch_t) NAME(fluxBatch_t);
+
+/**
+ * \brief States and fluxes of a batch of sides, packed per variable
+ */
+struct NAME(fluxBatch_t) {
+	real pVarL[NVAR][FLUX_BATCH];	/**< left side states, rotated into
+						normal direction */
+	real pVarR[NVAR][FLUX_BATCH];	/**< right side states, rotated into
+						normal direction */
+	real fluxConv[NVAR][FLUX_BATCH];	/**< local convective fluxes */
+	#ifdef navierstokes
+	real pVarMean[NVAR][FLUX_BATCH];	/**< mean of the side states */
+	#endif
+};
+
+/**
+ * \brief Maximum of two numbers, written as a blend
+ *
+ * Unlike `fmax`, which has to treat NaN arguments, this is vectorized in
+ * the batched flux functions.
+ *
+ * \param[in] a First number
+ * \param[in] b Second number
+ * \return The larger number
+ */
+real NAME(blendMax)(real a, real b)
+{
+	return ((RE(a) > RE(b)) ? a : b);
+}
+
+/**
+ * \brief Minimum of two numbers, written as a blend
+ * \param[in] a First number
+ * \param[in] b Second number
+ * \return The smaller number
+ */
+real NAME(blendMin)(real a, real b)
+{
+	return ((RE(a) < RE(b)) ? a : b);
+}
+
+/**
+ * \brief Roe flux for a batch of sides
+ *
+ * Both cases of the entropy fix are evaluated and blended, so that the loop
+ * over the sides is vectorized.
+ *
+ * \param[in] nBatch Number of sides in the batch
+ * \param[in] pVarL Left side states, rotated into normal direction
+ * \param[in] pVarR Right side states, rotated into normal direction
+ * \param[out] fluxLoc The local numeric fluxes
+ */
+void NAME(flux_roe_batch)(int nBatch, real pVarL[NVAR][FLUX_BATCH],
+	            real pVarR[NVAR][FLUX_BATCH], real fluxLoc[NVAR][FLUX_BATCH])
+{
+	#pragma omp simd
+	for (int i = 0; i < nBatch; ++i) {
+		real rhoL = pVarL[RHO][i], rhoR = pVarR[RHO][i];
+		real vxL  = pVarL[VX][i],  vxR  = pVarR[VX][i];
+		real vyL  = pVarL[VY][i],  vyR  = pVarR[VY][i];
+		real pL   = pVarL[P][i],   pR   = pVarR[P][i];
+
+		/* calculate left/right momentum and energy */
+		real mxL = rhoL * vxL;
+		real mxR = rhoR * vxR;
+		real myL = rhoL * vyL;
+		real myR = rhoR * vyR;
+
+		real eR = gam1q * pR + 0.5 * rhoR * (vxR * vxR + vyR * vyR);
+		real eL = gam1q * pL + 0.5 * rhoL * (vxL * vxL + vyL * vyL);
+
+		/* calculate left/right enthalpy */
+		real HR = (eR + pR) / rhoR;
+		real HL = (eL + pL) / rhoL;
+
+		/* calculate SQRT(rho) */
+		real rhoSqR = SQRT(rhoR);
+		real rhoSqL = SQRT(rhoL);
+		real rhoSqQsum = 1.0 / (rhoSqL + rhoSqR);
+
+		/* calculate Roe mean values */
+		real vxBar = (rhoSqR * vxR + rhoSqL * vxL) * rhoSqQsum;
+		real vyBar = (rhoSqR * vyR + rhoSqL * vyL) * rhoSqQsum;
+		real Hbar  = (rhoSqR *  HR + rhoSqL *  HL) * rhoSqQsum;
+		real cBar  = SQRT(gam1 * (Hbar - 0.5 * (vxBar * vxBar + vyBar * vyBar)));
+
+		/* calculate mean Eigenvalues, the second and third are equal */
+		real a1 = vxBar - cBar;
+		real a2 = vxBar;
+		real a4 = vxBar + cBar;
+
+		/* energy components of the mean eigenvectors, the others are
+		 * 0, 1, the Eigenvalues or vyBar */
+		real r1E = Hbar - vxBar * cBar;
+		real r2E = 0.5 * (vxBar * vxBar + vyBar * vyBar);
+		real r4E = Hbar + vxBar * cBar;
+
+		/* calculate differences */
+		real delRho = rhoR - rhoL;
+		real delMx  = mxR  - mxL;
+		real delMy  = myR  - myL;
+		real delE   = eR   - eL;
+		real delEq  = delE - (delMy - vyBar * delRho) * vyBar;
+
+		/* calculate wave strenght */
+		real cBarQ = 1.0 / cBar;
+		real gam2 = - gam1 * cBarQ * cBarQ * (delRho * (vxBar * vxBar - Hbar)
+				+ delEq - delMx * vxBar);
+		real gam1 = - 0.5 * cBarQ * (delMx - delRho * (vxBar + cBar)) - 0.5 * gam2;
+		real gam4 = delRho - gam1 - gam2;
+		real gam3 = delMy - vyBar * delRho;
+
+		/* calculate physical fluxes */
+		real fR[4] = {mxR, mxR * vxR + pR, mxR * vyR, vxR * (eR + pR)};
+		real fL[4] = {mxL, mxL * vxL + pL, mxL * vyL, vxL * (eL + pL)};
+
+		/* entropy fix */
+		real cL = SQRT(gam * pL / rhoL);
+		real cR = SQRT(gam * pR / rhoR);
+		real da1 = NAME(blendMax)(NAME(blendMax)(0.0, a1 - (vxL - cL)), (vxR - cR) - a1);
+		real da2 = NAME(blendMax)(NAME(blendMax)(0.0, a2 - vxL), vxR - a2);
+		real da4 = NAME(blendMax)(NAME(blendMax)(0.0, a4 - (vxL + cL)), (vxR + cR) - a4);
+		real abs1 = (RE(FABS(a1)) < RE(da1)) ? 0.5 * (a1 * a1 / da1 + da1) : FABS(a1);
+		real abs2 = (RE(FABS(a2)) < RE(da2)) ? 0.5 * (a2 * a2 / da2 + da2) : FABS(a2);
+		real abs4 = (RE(FABS(a4)) < RE(da4)) ? 0.5 * (a4 * a4 / da4 + da4) : FABS(a4);
+
+		/* calculate Roe flux */
+		fluxLoc[0][i] = 0.5 * (fR[0] + fL[0]
+				- gam1 * abs1
+				- gam2 * abs2
+				- gam4 * abs4);
+		fluxLoc[1][i] = 0.5 * (fR[1] + fL[1]
+				- gam1 * abs1 * a1
+				- gam2 * abs2 * vxBar
+				- gam4 * abs4 * a4);
+		fluxLoc[2][i] = 0.5 * (fR[2] + fL[2]
+				- gam1 * abs1 * vyBar
+				- gam2 * abs2 * vyBar
+				- gam3 * abs2
+				- gam4 * abs4 * vyBar);
+		fluxLoc[3][i] = 0.5 * (fR[3] + fL[3]
+				- gam1 * abs1 * r1E
+				- gam2 * abs2 * r2E
+				- gam3 * abs2 * vyBar
+				- gam4 * abs4 * r4E);
+	}
+}
+
+/**
+ * \brief HLL flux for a batch of sides
+ *
+ * The fluxes of all three wave configurations are evaluated and blended,
+ * so that the loop over the sides is vectorized.
+ *
+ * \param[in] nBatch Number of sides in the batch
+ * \param[in] pVarL Left side states, rotated into normal direction
+ * \param[in] pVarR Right side states, rotated into normal direction
+ * \param[out] fluxLoc The local numeric fluxes
+ */
+void NAME(flux_hll_batch)(int nBatch, real pVarL[NVAR][FLUX_BATCH],
+	            real pVarR[NVAR][FLUX_BATCH], real fluxLoc[NVAR][FLUX_BATCH])
+{
+	#pragma omp simd
+	for (int i = 0; i < nBatch; ++i) {
+		real rhoL = pVarL[RHO][i], rhoR = pVarR[RHO][i];
+		real vxL  = pVarL[VX][i],  vxR  = pVarR[VX][i];
+		real vyL  = pVarL[VY][i],  vyR  = pVarR[VY][i];
+		real pL   = pVarL[P][i],   pR   = pVarR[P][i];
+
+		/* calculation of auxiliary values */
+		real rhoLq = 1.0 / rhoL;
+		real rhoRq = 1.0 / rhoR;
+		real rhoSqL = SQRT(rhoL);
+		real rhoSqR = SQRT(rhoR);
+		real rhoSqQsum = 1.0 / (rhoSqL + rhoSqR);
+
+		/* calculate energies */
+		real eR = gam1q * pR + 0.5 * rhoR * (vxR * vxR + vyR * vyR);
+		real eL = gam1q * pL + 0.5 * rhoL * (vxL * vxL + vyL * vyL);
+
+		/* calculate left/right conservative state vector */
+		real uL[NVAR] = {rhoL, rhoL * vxL, rhoL * vyL, eL};
+		real uR[NVAR] = {rhoR, rhoR * vxR, rhoR * vyR, eR};
+
+		/* calculate flux in left/right cell */
+		real fL[NVAR] = {uL[MX], uL[MX] * vxL + pL, uL[MX] * vyL, vxL * (eL + pL)};
+		real fR[NVAR] = {uR[MX], uR[MX] * vxR + pR, uR[MX] * vyR, vxR * (eR + pR)};
+
+		/* calculation of speed of sounds */
+		real cL = SQRT(gam * pL * rhoLq);
+		real cR = SQRT(gam * pR * rhoRq);
+
+		/* calculation of left/right enthalpy */
+		real HL = (eL + pL) * rhoLq;
+		real HR = (eR + pR) * rhoRq;
+
+		/* calculation Row mean values */
+		real uM = (rhoSqR * vxR + rhoSqL * vxL) * rhoSqQsum;
+		real vM = (rhoSqR * vyR + rhoSqL * vyL) * rhoSqQsum;
+		real HM = (rhoSqR *  HR + rhoSqL *  HL) * rhoSqQsum;
+		real cM = SQRT(gam1 * (HM - 0.5 * (uM * uM + vM * vM)));
+
+		/* calculation signal speeds */
+		real arp = NAME(blendMax)(vxR + cR, uM + cM);
+		real alm = NAME(blendMin)(vxL - cL, uM - cM);
+		real arpAlmQ = 1.0 / (arp - alm);
+
+		/* calculation HLL flux */
+		real fM[NVAR];
+		fM[0] = (arp * fL[0] - alm * fR[0]) * arpAlmQ
+		      + (arp * alm) * arpAlmQ * (uR[0] - uL[0]);
+		fM[1] = (arp * fL[1] - alm * fR[1]) * arpAlmQ
+		      + (arp * alm) * arpAlmQ * (uR[1] - uL[1]);
+		fM[2] = (arp * fL[2] - alm * fR[2]) * arpAlmQ
+		      + (arp * alm) * arpAlmQ * (uR[2] - uL[2]);
+		fM[3] = (arp * fL[3] - alm * fR[3]) * arpAlmQ
+		      + (arp * alm) * arpAlmQ * (uR[3] - uL[3]);
+
+		fluxLoc[0][i] = (RE(alm) > 0.0) ? fL[0] : ((RE(arp) < 0.0) ? fR[0] : fM[0]);
+		fluxLoc[1][i] = (RE(alm) > 0.0) ? fL[1] : ((RE(arp) < 0.0) ? fR[1] : fM[1]);
+		fluxLoc[2][i] = (RE(alm) > 0.0) ? fL[2] : ((RE(arp) < 0.0) ? fR[2] : fM[2]);
+		fluxLoc[3][i] = (RE(alm) > 0.0) ? fL[3] : ((RE(arp) < 0.0) ? fR[3] : fM[3]);
+	}
+}
+
+/**
+ * \brief HLLE flux
+ * \param[in] rhoL Left side density
+ * \param[in] rhoR Right side density
+ * \param[in] vxL Left side x-velocity
+ * \param[in] vxR Right side x-velocity
+ * \param[in] vyL Left side y-velocity
+ * \param[in] vyR Right side y-velocity
+ * \param[in] pL Left side pressure
+ * \param[in] pR Right side pressure
+ * \param[out] fluxLoc The local numeric flux
+ */
+void NAME(flux_hlle)(real rhoL, real rhoR,
+	       real vxL,  real vxR,
+	       real vyL,  real vyR,
+	       real pL,   real pR,
+	       real fluxLoc[4])
+{
+	/* calculation of auxiliary values */
+	real rhoLq = 1.0 / rhoL;
+	real rhoRq = 1.0 / rhoR;
+	real rhoSqL = SQRT(rhoL);
+	real rhoSqR = SQRT(rhoR);
+	real rhoSqQsum = 1.0 / (rhoSqL + rhoSqR);
+
+	/* calculate energies */
+	real eR = gam1q * pR + 0.5 * rhoR * (vxR * vxR + vyR * vyR);
+	real eL = gam1q * pL + 0.5 * rhoL * (vxL * vxL + vyL * vyL);
+
+	/* calculate left/right conservative state vector */
+	real uL[NVAR] = {rhoL, rhoL * vxL, rhoL * vyL, eL};
+	real uR[NVAR] = {rhoR, rhoR * vxR, rhoR * vyR, eR};
+
+	/* calculate flux in left/right cell */
+	real fL[NVAR] = {uL[MX], uL[MX] * vxL + pL, uL[MX] * vyL, vxL * (eL + pL)};
+	real fR[NVAR] = {uR[MX], uR[MX] * vxR + pR, uR[MX] * vyR, vxR * (eR + pR)};
+
+	/* calculation of speed of sounds */
+	real cL = SQRT(gam * pL * rhoLq);
+	real cR = SQRT(gam * pR * rhoRq);
+
+	/* calculation Row mean values */
+	real uM = (rhoSqR * vxR + rhoSqL * vxL) * rhoSqQsum;
+
+	/* signal speeds, version of Einfeld paper */
+	real eta2 = 0.5 * rhoSqR * rhoSqL / (rhoSqR + rhoSqL) / (rhoSqR + rhoSqL);
+	real d = SQRT((rhoSqR * cR * cR + rhoSqL * cL * cL) * rhoSqQsum
+			+ eta2 * (vxR - vxL) * (vxR - vxL));
+	real arp = FMAX(vxR + cR, uM + d);
+	real alm = FMIN(vxL - cL, uM - d);
+	real arpAlmQ = 1.0 / (arp - alm);
+
+	/* calculation HLLE flux */
+	if (RE(alm) > 0.0) {
+		fluxLoc[0] = fL[0];
+		fluxLoc[1] = fL[1];
+		fluxLoc[2] = fL[2];
+		fluxLoc[3] = fL[3];
+	} else if (RE(arp) < 0.0) {
+		fluxLoc[0] = fR[0];
+		fluxLoc[1] = fR[1];
+		fluxLoc[2] = fR[2];
+		fluxLoc[3] = fR[3];
+	} else {
+		fluxLoc[0] = (arp * fL[0] - alm * fR[0]) * arpAlmQ
+			   + (arp * alm) * arpAlmQ * (uR[0] - uL[0]);
+		fluxLoc[1] = (arp * fL[1] - alm * fR[1]) * arpAlmQ
+			   + (arp * alm) * arpAlmQ * (uR[1] - uL[1]);
+		fluxLoc[2] = (arp * fL[2] - alm * fR[2]) * arpAlmQ
+			   + (arp * alm) * arpAlmQ * (uR[2] - uL[2]);
+		fluxLoc[3] = (arp * fL[3] - alm * fR[3]) * arpAlmQ
+			   + (arp * alm) * arpAlmQ * (uR[3] - uL[3]);
+	}
+}
+
+/**
+ * \brief HLLC flux for a batch of sides
+ *
+ * The fluxes of all wave configurations are evaluated and blended, so that
+ * the loop over the sides is vectorized.
+ *
+ * \param[in] nBatch Number of sides in the batch
+ * \param[in] pVarL Left side states, rotated into normal direction
+ * \param[in] pVarR Right side states, rotated into normal direction
+ * \param[out] fluxLoc The local numeric fluxes
+ */
+void NAME(flux_hllc_batch)(int nBatch, real pVarL[NVAR][FLUX_BATCH],
+	             real pVarR[NVAR][FLUX_BATCH], real fluxLoc[NVAR][FLUX_BATCH])
+{
+	#pragma omp simd
+	for (int i = 0; i < nBatch; ++i) {
+		real rhoL = pVarL[RHO][i], rhoR = pVarR[RHO][i];
+		real vxL  = pVarL[VX][i],  vxR  = pVarR[VX][i];
+		real vyL  = pVarL[VY][i],  vyR  = pVarR[VY][i];
+		real pL   = pVarL[P][i],   pR   = pVarR[P][i];
+
+		/* calculation of auxiliary values */
+		real rhoLq = 1.0 / rhoL;
+		real rhoRq = 1.0 / rhoR;
+		real rhoSqL = SQRT(rhoL);
+		real rhoSqR = SQRT(rhoR);
+		real rhoSqQsum = 1.0 / (rhoSqL + rhoSqR);
+
+		/* calculate energies */
+		real eR = gam1q * pR + 0.5 * rhoR * (vxR * vxR + vyR * vyR);
+		real eL = gam1q * pL + 0.5 * rhoL * (vxL * vxL + vyL * vyL);
+
+		/* calculate left/right conservative state vector */
+		real uL[NVAR] = {rhoL, rhoL * vxL, rhoL * vyL, eL};
+		real uR[NVAR] = {rhoR, rhoR * vxR, rhoR * vyR, eR};
+
+		/* calculate flux in left/right cell */
+		real fL[NVAR] = {uL[MX], uL[MX] * vxL + pL, uL[MX] * vyL, vxL * (eL + pL)};
+		real fR[NVAR] = {uR[MX], uR[MX] * vxR + pR, uR[MX] * vyR, vxR * (eR + pR)};
+
+		/* calculation of speed of sounds */
+		real cL = SQRT(gam * pL * rhoLq);
+		real cR = SQRT(gam * pR * rhoRq);
+
+		/* calculation of left/right enthalpy */
+		real HL = (eL + pL) * rhoLq;
+		real HR = (eR + pR) * rhoRq;
+
+		/* calculation Row mean values */
+		real uM = (rhoSqR * vxR + rhoSqL * vxL) * rhoSqQsum;
+		real vM = (rhoSqR * vyR + rhoSqL * vyL) * rhoSqQsum;
+		real HM = (rhoSqR *  HR + rhoSqL *  HL) * rhoSqQsum;
+		real cM = SQRT(gam1 * (HM - 0.5 * (uM * uM + vM * vM)));
+
+		/* calculation signal speeds */
+		real arp = NAME(blendMax)(vxR + cR, uM + cM);
+		real alm = NAME(blendMin)(vxL - cL, uM - cM);
+		real as = (pR - pL + uL[MX] * (alm - vxL) - uR[MX] * (arp - vxR))
+			/ (rhoL * (alm - vxL) - rhoR * (arp - vxR));
+
+		/* left star state flux */
+		real facL = rhoL * (alm - vxL) / (alm - as);
+		real usL[NVAR] = {facL,
+				    as * facL,
+				    vyL * facL,
+				    facL * (eL / rhoL + (as - vxL) *
+					(as + pL / (rhoL * (alm - vxL))))};
+		real fsL[NVAR];
+		fsL[0] = fL[0] + alm * (usL[0] - uL[0]);
+		fsL[1] = fL[1] + alm * (usL[1] - uL[1]);
+		fsL[2] = fL[2] + alm * (usL[2] - uL[2]);
+		fsL[3] = fL[3] + alm * (usL[3] - uL[3]);
+
+		/* right star state flux */
+		real facR = rhoR * (arp - vxR) / (arp - as);
+		real usR[NVAR] = {facR,
+				    as * facR,
+				    vyR * facR,
+				    facR * (eR / rhoR + (as - vxR) *
+					(as + pR / (rhoR * (arp - vxR))))};
+		real fsR[NVAR];
+		fsR[0] = fR[0] + arp * (usR[0] - uR[0]);
+		fsR[1] = fR[1] + arp * (usR[1] - uR[1]);
+		fsR[2] = fR[2] + arp * (usR[2] - uR[2]);
+		fsR[3] = fR[3] + arp * (usR[3] - uR[3]);
+
+		/* calculation HLLC flux */
+		bool isLeft = (RE(alm) <= 0.0) && (RE(as) >= 0.0);
+		real fs[NVAR];
+		fs[0] = isLeft ? fsL[0] : fsR[0];
+		fs[1] = isLeft ? fsL[1] : fsR[1];
+		fs[2] = isLeft ? fsL[2] : fsR[2];
+		fs[3] = isLeft ? fsL[3] : fsR[3];
+
+		fluxLoc[0][i] = (RE(alm) > 0.0) ? fL[0] : ((RE(arp) < 0.0) ? fR[0] : fs[0]);
+		fluxLoc[1][i] = (RE(alm) > 0.0) ? fL[1] : ((RE(arp) < 0.0) ? fR[1] : fs[1]);
+		fluxLoc[2][i] = (RE(alm) > 0.0) ? fL[2] : ((RE(arp) < 0.0) ? fR[2] : fs[2]);
+		fluxLoc[3][i] = (RE(alm) > 0.0) ? fL[3] : ((RE(arp) < 0.0) ? fR[3] : fs[3]);
+	}
+}
+
+/**
+ * \brief Lax-Friedrichs flux
+ * \param[in] rhoL Left side density
+ * \param[in] rhoR Right side density
+ * \param[in] vxL Left side x-velocity
+ * \param[in] vxR Right side x-velocity
+ * \param[in] vyL Left side y-velocity
+ * \param[in] vyR Right side y-velocity
+ * \param[in] pL Left side pressure
+ * \param[in] pR Right side pressure
+ * \param[out] fluxLoc The local numeric flux
+ */
+void NAME(flux_lxf)(real rhoL, real rhoR,
+	      real vxL,  real vxR,
+	      real vyL,  real vyR,
+	      real pL,   real pR,
+	      real fluxLoc[4])
+{
+	/* compute maximum Eigenvalue */
+	real cL = SQRT(gam * pL / rhoL);
+	real cR = SQRT(gam * pR / rhoR);
+	real a  = FMAX(FABS(vxR) + cR, FABS(vxL) + cL);
+
+	/* calculate left/right energy and enthalpy */
+	real eL = gam1q * pL + 0.5 * rhoL * (vxL * vxL + vyL * vyL);
+	real eR = gam1q * pR + 0.5 * rhoR * (vxR * vxR + vyR * vyR);
+
+	/* calculate the differences of the conservative variables */
+	real delU[NVAR] = {rhoR       - rhoL,
+			     rhoR * vxR - rhoL * vxL,
+			     rhoR * vyR - rhoL * vyL,
+			     eR         - eL};
+
+	/* calculate the physical fluxes */
+	real fL[4] = {rhoL * vxL,
+			 rhoL * vxL * vxL + pL,
+			 rhoL * vxL * vyL,
+			 vxL * (eL + pL)};
+	real fR[4] = {rhoR * vxR,
+			 rhoR * vxR * vxR + pR,
+			 rhoR * vxR * vyR,
+			 vxR * (eR + pR)};
+
+	/* calculate local Lax-Friedrichs flux */
+	fluxLoc[0] = 0.5 * (fR[0] + fL[0]) - 0.5 * a * delU[0];
+	fluxLoc[1] = 0.5 * (fR[1] + fL[1]) - 0.5 * a * delU[1];
+	fluxLoc[2] = 0.5 * (fR[2] + fL[2]) - 0.5 * a * delU[2];
+	fluxLoc[3] = 0.5 * (fR[3] + fL[3]) - 0.5 * a * delU[3];
+}
+
+/**
+ * \brief Steger-Warming flux
+ * \param[in] rhoL Left side density
+ * \param[in] rhoR Right side density
+ * \param[in] vxL Left side x-velocity
+ * \param[in] vxR Right side x-velocity
+ * \param[in] vyL Left side y-velocity
+ * \param[in] vyR Right side y-velocity
+ * \param[in] pL Left side pressure
+ * \param[in] pR Right side pressure
+ * \param[out] fluxLoc The local numeric flux
+ */
+void NAME(flux_stw)(real rhoL, real rhoR,
+	      real vxL,  real vxR,
+	      real vyL,  real vyR,
+	      real pL,   real pR,
+	      real fluxLoc[4])
+{
+	/* calculation of speed of sound */
+	real cL = SQRT(gam * pL / rhoL);
+	real cR = SQRT(gam * pR / rhoR);
+
+	/* auxiliary values */
+	real gam2q = 0.5 / gam;
+
+	/* calculation of eigenvalues */
+	real aL[4] = {vxL - cL, vxL, vxL, vxL + cL};
+	real aR[4] = {vxR - cR, vxR, vxR, vxR + cR};
+
+	/* calculation of positive and negative Eigenvalues */
+	real ap[4] = {FMAX(aL[0], 0.0),
+			FMAX(aL[1], 0.0),
+			FMAX(aL[2], 0.0),
+			FMAX(aL[3], 0.0)};
+	real am[4] = {FMIN(aR[0], 0.0),
+			FMIN(aR[1], 0.0),
+			FMIN(aR[2], 0.0),
+			FMIN(aR[3], 0.0)};
+
+	/* calculate positve flux from left and right */
+	real fp[4];
+	fp[0] =	rhoL * gam2q * (2.0 * gam1 * ap[1] + ap[0] + ap[3]);
+	fp[1] = fp[0] * vxL + (ap[3] - ap[0])* rhoL * cL * gam2q;
+	fp[2] = fp[0] * vyL;
+	fp[3] = fp[0] * 0.5 * (vxL * vxL + vyL * vyL) + (ap[3] - ap[0])*
+			rhoL * cL * vxL * gam2q + (ap[3] + ap[0]) *
+			rhoL * cL * cL * gam2q * gam1q;
+
+	/* calculate negative flux from right and left */
+	real fm[4];
+	fm[0] =	rhoR * gam2q * (2.0 * gam1 * am[1] + am[0] + am[3]);
+	fm[1] = fm[0] * vxR + (am[3] - am[0])* rhoR * cR * gam2q;
+	fm[2] = fm[0] * vyR;
+	fm[3] = fm[0] * 0.5 * (vxR * vxR + vyR * vyR) + (am[3] - am[0])*
+			rhoR * cR * vxR * gam2q + (am[3] + am[0]) *
+			rhoR * cR * cR * gam2q * gam1q;
+	/* calculate  Steger-Warming flux */
+	fluxLoc[0] = fp[0] + fm[0];
+	fluxLoc[1] = fp[1] + fm[1];
+	fluxLoc[2] = fp[2] + fm[2];
+	fluxLoc[3] = fp[3] + fm[3];
+}
+
+/**
+ * \brief Central flux
+ * \note This flux is unconditionally unstable, it can be stabilized by adding artificial viscosity (Jameson method). This is not implemented, however.
+ * \param[in] rhoL Left side density
+ * \param[in] rhoR Right side density
+ * \param[in] vxL Left side x-velocity
+ * \param[in] vxR Right side x-velocity
+ * \param[in] vyL Left side y-velocity
+ * \param[in] vyR Right side y-velocity
+ * \param[in] pL Left side pressure
+ * \param[in] pR Right side pressure
+ * \param[out] fluxLoc The local numeric flux
+ */
+void NAME(flux_cen)(real rhoL, real rhoR,
+	      real vxL,  real vxR,
+	      real vyL,  real vyR,
+	      real pL,   real pR,
+	      real fluxLoc[4])
+{
+	/* calculate energies */
+	real eL = gam1q * pL + 0.5 * rhoL * (vxL * vxL + vyL * vyL);
+	real eR = gam1q * pR + 0.5 * rhoR * (vxR * vxR + vyR * vyR);
+
+	/* calculate the physical fluxes */
+	real fL[4], fR[4];
+	fL[0] = rhoL * vxL;
+	fL[1] = fL[0] * vxL + pL;
+	fL[2] = fL[0] * vyL;
+	fL[3] = vxL * (eL + pL);
+
+	fR[0] = rhoR * vxR;
+	fR[1] = fR[0] * vxR + pR;
+	fR[2] = fR[0] * vyR;
+	fR[3] = vxR * (eR + pR);
+
+	/* calculate central flux */
+	fluxLoc[0] = 0.5 * (fL[0] + fR[0]);
+	fluxLoc[1] = 0.5 * (fL[1] + fR[1]);
+	fluxLoc[2] = 0.5 * (fL[2] + fR[2]);
+	fluxLoc[3] = 0.5 * (fL[3] + fR[3]);
+}
+
+/**
+ * \brief AUSMD flux for a batch of sides
+ *
+ * The split velocities and pressures of the subsonic and supersonic cases
+ * are evaluated and blended, so that the loop over the sides is vectorized.
+ *
+ * \param[in] nBatch Number of sides in the batch
+ * \param[in] pVarL Left side states, rotated into normal direction
+ * \param[in] pVarR Right side states, rotated into normal direction
+ * \param[out] fluxLoc The local numeric fluxes
+ */
+void NAME(flux_ausmd_batch)(int nBatch, real pVarL[NVAR][FLUX_BATCH],
+	              real pVarR[NVAR][FLUX_BATCH], real fluxLoc[NVAR][FLUX_BATCH])
+{
+	#pragma omp simd
+	for (int i = 0; i < nBatch; ++i) {
+		real rhoL = pVarL[RHO][i], rhoR = pVarR[RHO][i];
+		real vxL  = pVarL[VX][i],  vxR  = pVarR[VX][i];
+		real vyL  = pVarL[VY][i],  vyR  = pVarR[VY][i];
+		real pL   = pVarL[P][i],   pR   = pVarR[P][i];
+
+		/* calculate left/right energy and enthalpy */
+		real eL = gam1q * pL + 0.5 * rhoL * (vxL * vxL + vyL * vyL);
+		real eR = gam1q * pR + 0.5 * rhoR * (vxR * vxR + vyR * vyR);
+
+		real HL = (eL + pL) / rhoL;
+		real HR = (eR + pR) / rhoR;
+
+		/* maximum speed of sound */
+		real cm = NAME(blendMax)(SQRT(gam * pL / rhoL), SQRT(gam * pR / rhoR));
+
+		real alphaL = 2.0 * pL / rhoL / (pL / rhoL + pR / rhoR);
+		real alphaR = 2.0 * pR / rhoR / (pL / rhoL + pR / rhoR);
+
+		bool isSubsonicL = (RE(FABS(vxL)) < RE(cm));
+		real uPlus = isSubsonicL
+			? 0.25 * alphaL * (vxL + cm) * (vxL + cm) / cm
+				+ 0.5 * (1.0 - alphaL) * (vxL + FABS(vxL))
+			: 0.5 * (vxL + FABS(vxL));
+		real pPlus = isSubsonicL
+			? 0.25 * pL * (vxL + cm) * (vxL + cm) / (cm * cm) * (2.0 - vxL / cm)
+			: 0.5 * pL * (vxL + FABS(vxL)) / vxL;
+
+		bool isSubsonicR = (RE(FABS(vxR)) < RE(cm));
+		real uMinus = isSubsonicR
+			? - 0.25 * alphaR * (vxR - cm) * (vxR - cm) / cm
+				+ 0.5 * (1.0 - alphaR) * (vxR - FABS(vxR))
+			: 0.5 * (vxR - FABS(vxR));
+		real pMinus = isSubsonicR
+			? 0.25 * pR * (vxR - cm) * (vxR - cm) / (cm * cm) * (2.0 + vxR / cm)
+			: 0.5 * pR * (vxR - FABS(vxR)) / vxR;
+
+		/* calculate AUSMD flux */
+		real rhoU = uPlus * rhoL + uMinus * rhoR;
+		fluxLoc[0][i] = rhoU;
+		fluxLoc[1][i] = 0.5 * (rhoU * (vxR + vxL) - FABS(rhoU) * (vxR - vxL))
+				+ (pPlus + pMinus);
+		fluxLoc[2][i] = 0.5 * (rhoU * (vyR + vyL) - FABS(rhoU) * (vyR - vyL));
+		fluxLoc[3][i] = 0.5 * (rhoU * (HR + HL) - FABS(rhoU) * (HR - HL));
+	}
+}
+
+/**
+ * \brief AUSMDV flux
+ * \bug This function produces incorrect output, refrain from using it for the
+ *	time being
+ * \param[in] rhoL Left side density
+ * \param[in] rhoR Right side density
+ * \param[in] vxL Left side x-velocity
+ * \param[in] vxR Right side x-velocity
+ * \param[in] vyL Left side y-velocity
+ * \param[in] vyR Right side y-velocity
+ * \param[in] pL Left side pressure
+ * \param[in] pR Right side pressure
+ * \param[out] fluxLoc The local numeric flux
+ */
+void NAME(flux_ausmdv)(real rhoL, real rhoR,
+	         real vxL,  real vxR,
+	         real vyL,  real vyR,
+	         real pL,   real pR,
+	         real fluxLoc[4])
+{
+	/* calculate left/right energy and enthalpy */
+	real eL = gam1q * pL + 0.5 * rhoL * (vxL * vxL + vyL * vyL);
+	real eR = gam1q * pR + 0.5 * rhoR * (vxR * vxR + vyR * vyR);
+
+	real HL = (eL + pL) / rhoL;
+	real HR = (eR + pR) / rhoR;
+
+	/* maximum speed of sound */
+	real cL = SQRT(gam * pL / rhoL);
+	real cR = SQRT(gam * pR / rhoR);
+	real cm = FMAX(cL, cR);
+
+	real alphaL = 2.0 * pL / rhoL / (pL / rhoL + pR / rhoR);
+	real alphaR = 2.0 * pR / rhoR / (pL / rhoL + pR / rhoR);
+
+	real uPlus, pPlus;
+	if (RE(FABS(vxL)) < RE(cm)) {
+		pPlus = 0.25 * pL * (vxL + cm) * (vxL + cm) / (cm * cm) * (2.0 - vxL / cm);
+		if (RE(vxL) > 0.0) {
+			uPlus = vxL + alphaL * (vxL - cm) * (vxL - cm);
+		} else {
+			uPlus =       alphaL * (vxL + cm) * (vxL + cm);
+		}
+	} else {
+		if (RE(vxL) > 0.0) {
+			uPlus = vxL;
+			pPlus = pL;
+		} else {
+			uPlus = 0.0;
+			pPlus = 0.0;
+		}
+	}
+
+	real uMinus, pMinus;
+	if (RE(FABS(vxR)) < RE(cm)) {
+		pMinus = 0.25 * pR * (vxR - cm) * (vxR - cm) / (cm * cm) * (2.0 + vxR / cm);
+		if (RE(vxR) > 0.0) {
+			uMinus =     - alphaR * (vxL - cm) * (vxL - cm);
+		} else {
+			uMinus = vxR - alphaR * (vxR + cm) * (vxR + cm);
+		}
+	} else {
+		if (RE(vxR) > 0.0) {
+			uMinus = 0.0;
+			pMinus = 0.0;
+		} else {
+			uMinus = vxR;
+			pMinus = pR;
+		}
+	}
+
+	/* calculate AUSMDV flux */
+	real rhoU = uPlus * rhoL + uMinus * rhoR;
+
+	real s = FMIN(1.0, 10.0 * FABS(pR - pL) / FMIN(pR, pL));
+	real rhoUsq = 0.5 * (1.0 + s) * (rhoL * vxL * uPlus + rhoR * vxR * uMinus);
+	rhoUsq += 0.25 * (1.0 - s) * (rhoU * (vxR + vxL) - FABS(rhoU) * (vxR - vxL));
+
+	fluxLoc[0] = rhoU;
+	fluxLoc[1] = rhoUsq + (pPlus + pMinus);
+	fluxLoc[2] = 0.5 * (rhoU * (vyR + vyL) - FABS(rhoU) * (vyR - vyL));
+	fluxLoc[3] = 0.5 * (rhoU * (HR + HL) - FABS(rhoU) * (HR - HL));
+
+	/* entropy fix */
+	bool tmpa = (RE(vxL - cL) < 0.0) && (RE(vxR - cR) > 0.0);
+	bool tmpb = (RE(vxL + cL) < 0.0) && (RE(vxR + cR) > 0.0);
+	real tmpL[4] = {1.0, vxL, vyL, HL};
+	real tmpR[4] = {1.0, vxR, vyR, HR};
+	if (tmpa && !tmpb) {
+		fluxLoc[0] -= 0.125 * ((vxR - cR) - (vxL - cL)) * (rhoR * tmpR[0] - rhoL * tmpL[0]);
+		fluxLoc[1] -= 0.125 * ((vxR - cR) - (vxL - cL)) * (rhoR * tmpR[1] - rhoL * tmpL[1]);
+		fluxLoc[2] -= 0.125 * ((vxR - cR) - (vxL - cL)) * (rhoR * tmpR[2] - rhoL * tmpL[2]);
+		fluxLoc[3] -= 0.125 * ((vxR - cR) - (vxL - cL)) * (rhoR * tmpR[3] - rhoL * tmpL[3]);
+	}
+	if (!tmpa && tmpb) {
+		fluxLoc[0] -= 0.125 * ((vxR + cR) - (vxL + cL)) * (rhoR * tmpR[0] - rhoL * tmpL[0]);
+		fluxLoc[1] -= 0.125 * ((vxR + cR) - (vxL + cL)) * (rhoR * tmpR[1] - rhoL * tmpL[1]);
+		fluxLoc[2] -= 0.125 * ((vxR + cR) - (vxL + cL)) * (rhoR * tmpR[2] - rhoL * tmpL[2]);
+		fluxLoc[3] -= 0.125 * ((vxR + cR) - (vxL + cL)) * (rhoR * tmpR[3] - rhoL * tmpL[3]);
+	}
+}
+
+/**
+ * \brief Van Leer flux for a batch of sides
+ *
+ * The split fluxes of all Mach number regimes are evaluated and blended, so
+ * that the loop over the sides is vectorized.
+ *
+ * \param[in] nBatch Number of sides in the batch
+ * \param[in] pVarL Left side states, rotated into normal direction
+ * \param[in] pVarR Right side states, rotated into normal direction
+ * \param[out] fluxLoc The local numeric fluxes
+ */
+void NAME(flux_vanleer_batch)(int nBatch, real pVarL[NVAR][FLUX_BATCH],
+	                real pVarR[NVAR][FLUX_BATCH], real fluxLoc[NVAR][FLUX_BATCH])
+{
+	#pragma omp simd
+	for (int i = 0; i < nBatch; ++i) {
+		real rhoL = pVarL[RHO][i], rhoR = pVarR[RHO][i];
+		real vxL  = pVarL[VX][i],  vxR  = pVarR[VX][i];
+		real vyL  = pVarL[VY][i],  vyR  = pVarR[VY][i];
+		real pL   = pVarL[P][i],   pR   = pVarR[P][i];
+
+		/* calculate speed of sound */
+		real cL = SQRT(gam * pL / rhoL);
+		real cR = SQRT(gam * pR / rhoR);
+
+		/* calculate left/right energy and enthalpy */
+		real eL = gam1q * pL + 0.5 * rhoL * (vxL * vxL + vyL * vyL);
+		real eR = gam1q * pR + 0.5 * rhoR * (vxR * vxR + vyR * vyR);
+
+		real HL = (eL + pL) / rhoL;
+		real HR = (eR + pR) / rhoR;
+
+		/* positive flux from left to right, supersonic and subsonic */
+		real ML = vxL / cL;
+		real fpSup[4], fpSub[4];
+		fpSup[0] = rhoL * vxL;
+		fpSup[1] = fpSup[0] * vxL + pL;
+		fpSup[2] = fpSup[0] * vyL;
+		fpSup[3] = fpSup[0] * HL;
+
+		real cxL = gam1 * vxL + 2.0 * cL;
+		fpSub[0] = 0.25 * rhoL * cL * (ML + 1.0) * (ML + 1.0);
+		fpSub[1] = fpSub[0] * cxL / gam;
+		fpSub[2] = fpSub[0] * vyL;
+		fpSub[3] = 0.5 * (fpSub[1] * cxL * gam / (gam * gam - 1.0) + fpSub[2] * vyL);
+
+		bool isSupersonicL = (RE(ML) > 1.0);
+		bool isSubsonicL = (RE(ML) < 1.0) && (RE(ML) > - 1.0);
+		real fp[4];
+		fp[0] = isSupersonicL ? fpSup[0] : (isSubsonicL ? fpSub[0] : 0.0);
+		fp[1] = isSupersonicL ? fpSup[1] : (isSubsonicL ? fpSub[1] : 0.0);
+		fp[2] = isSupersonicL ? fpSup[2] : (isSubsonicL ? fpSub[2] : 0.0);
+		fp[3] = isSupersonicL ? fpSup[3] : (isSubsonicL ? fpSub[3] : 0.0);
+
+		/* negative flux from right to left, supersonic and subsonic */
+		real MR = vxR / cR;
+		real fmSup[4], fmSub[4];
+		fmSup[0] = rhoR * vxR;
+		fmSup[1] = fmSup[0] * vxR + pR;
+		fmSup[2] = fmSup[0] * vyR;
+		fmSup[3] = fmSup[0] * HR;
+
+		real cxR = gam1 * vxR - 2.0 * cR;
+		fmSub[0] = - 0.25 * rhoR * cR * (1.0 - MR) * (1.0 - MR);
+		fmSub[1] = fmSub[0] * cxR / gam;
+		fmSub[2] = fmSub[0] * vyR;
+		fmSub[3] = 0.5 * (fmSub[1] * cxR * gam / (gam * gam - 1.0) + fmSub[2] * vyR);
+
+		bool isSupersonicR = (RE(MR) < - 1.0);
+		bool isSubsonicR = (RE(MR) < 1.0) && (RE(MR) > - 1.0);
+		real fm[4];
+		fm[0] = isSupersonicR ? fmSup[0] : (isSubsonicR ? fmSub[0] : 0.0);
+		fm[1] = isSupersonicR ? fmSup[1] : (isSubsonicR ? fmSub[1] : 0.0);
+		fm[2] = isSupersonicR ? fmSup[2] : (isSubsonicR ? fmSub[2] : 0.0);
+		fm[3] = isSupersonicR ? fmSup[3] : (isSubsonicR ? fmSub[3] : 0.0);
+
+		/* calculate van Leer flux */
+		fluxLoc[0][i] = fp[0] + fm[0];
+		fluxLoc[1][i] = fp[1] + fm[1];
+		fluxLoc[2][i] = fp[2] + fm[2];
+		fluxLoc[3][i] = fp[3] + fm[3];
+	}
+}
+
+/**
+ * \brief Generate the batch version of a flux function for a single side
+ *
+ * The batch version evaluates the flux function side by side, the call to the
+ * single side function is inlined into the loop.
+ */
+#define FLUX_BY_SIDE(name) \
+void NAME(flux_##name##_batch)(int nBatch, real pVarL[NVAR][FLUX_BATCH], \
+		real pVarR[NVAR][FLUX_BATCH], real fluxLoc[NVAR][FLUX_BATCH]) \
+{ \
+	for (int i = 0; i < nBatch; ++i) { \
+		real f[4]; \
+		NAME(flux_##name)(pVarL[RHO][i], pVarR[RHO][i], \
+			    pVarL[VX][i],  pVarR[VX][i], \
+			    pVarL[VY][i],  pVarR[VY][i], \
+			    pVarL[P][i],   pVarR[P][i], \
+			    f); \
+ \
+		fluxLoc[0][i] = f[0]; \
+		fluxLoc[1][i] = f[1]; \
+		fluxLoc[2][i] = f[2]; \
+		fluxLoc[3][i] = f[3]; \
+	} \
+}
+
+FLUX_BY_SIDE(hlle)
+FLUX_BY_SIDE(lxf)
+FLUX_BY_SIDE(stw)
+FLUX_BY_SIDE(cen)
+FLUX_BY_SIDE(ausmdv)
+
+#ifndef DUAL_NUMBERS
+FLUX_BY_SIDE(god)
+#endif
+
+#ifdef navierstokes
+/**
+ * \brief Calculate the diffusive flux
+ * \param[in] state Mean conservative state of the two cells
+ * \param[in] gradX The x-gradient at the side
+ * \param[in] gradY The y-gradient at the side
+ * \param[out] f Diffusive flux in x-direction
+ * \param[out] g Diffusive flux in y-direction
+ */
+void NAME(diffusionFlux)(real state[NVAR], real gradX[NVAR], real gradY[NVAR],
+		real f[NVAR], real g[NVAR])
+{
+	/* f[RHO] = 0.0; */
+	f[MX]  = (4.0 / 3.0 * gradX[MX] - 2.0 / 3.0 * gradY[MY]) * mu;
+	f[MY]  = (gradY[MX] + gradX[MY]) * mu;
+	f[E]   = (4.0 / 3.0 * state[MX] * gradX[MX] - 2.0 / 3.0 * state[MX] * gradY[MY]
+		+ (gradX[MY] + gradY[MX]) * state[MY]
+		+ gam / (gam1 * Pr * state[RHO] * state[RHO])
+		* (state[RHO] * gradX[P] - state[P] * gradX[RHO])) * mu;
+
+	/* g[RHO] = 0.0; */
+	g[MX]  = (gradY[MX] + gradX[MY]) * mu;
+	g[MY]  = (4.0 / 3.0 * gradY[MY] - 2.0 / 3.0 * gradX[MX]) * mu;
+	g[E]   = (4.0 / 3.0 * state[MY] * gradY[MY] - 2.0 / 3.0 * state[MY] * gradX[MX]
+		+ (gradY[MX] + gradX[MY]) * state[MX]
+		+ gam / (gam1 * Pr * state[RHO] * state[RHO])
+		* (state[RHO] * gradY[P] - state[P] * gradY[RHO])) * mu;
+}
+
+/**
+ * \brief Calculate the gradients of the primitive variables at a side
+ *
+ * The mean of the gradients of both elements is corrected in the direction
+ * connecting the barycenters by the difference of the element states.
+ *
+ * \param[in] aSide A pointer to the side
+ * \param[out] gradUx The x-gradient at the side
+ * \param[out] gradUy The y-gradient at the side
+ */
+void NAME(sideGradients)(side_t *aSide, real gradUx[NVAR], real gradUy[NVAR])
+{
+	long iElemL = aSide->elem - elemBlock;
+	long iElemR = aSide->connection->elem - elemBlock;
+	real *pVarL = STATE.pVar[iElemL], *pVarR = STATE.pVar[iElemR];
+	real *u_xL = STATE.u_x[iElemL], *u_xR = STATE.u_x[iElemR];
+	real *u_yL = STATE.u_y[iElemL], *u_yR = STATE.u_y[iElemR];
+
+	real gradUxMean[NVAR] = {
+		0.5 * (u_xL[RHO] + u_xR[RHO]),
+		0.5 * (u_xL[VX]  + u_xR[VX]),
+		0.5 * (u_xL[VY]  + u_xR[VY]),
+		0.5 * (u_xL[P]   + u_xR[P])
+	};
+	real gradUyMean[NVAR] = {
+		0.5 * (u_yL[RHO] + u_yR[RHO]),
+		0.5 * (u_yL[VX]  + u_yR[VX]),
+		0.5 * (u_yL[VY]  + u_yR[VY]),
+		0.5 * (u_yL[P]   + u_yR[P])
+	};
+	double baryBary[NDIM] = {
+		aSide->baryBaryVec[X] / aSide->baryBaryDist,
+		aSide->baryBaryVec[Y] / aSide->baryBaryDist
+	};
+	real correction[NVAR] = {
+		gradUxMean[RHO] * baryBary[X] + gradUyMean[RHO] * baryBary[Y] - (pVarR[RHO] - pVarL[RHO]) / aSide->baryBaryDist,
+		gradUxMean[VX]  * baryBary[X] + gradUyMean[VX]  * baryBary[Y] - (pVarR[VX]  - pVarL[VX])  / aSide->baryBaryDist,
+		gradUxMean[VY]  * baryBary[X] + gradUyMean[VY]  * baryBary[Y] - (pVarR[VY]  - pVarL[VY])  / aSide->baryBaryDist,
+		gradUxMean[P]   * baryBary[X] + gradUyMean[P]   * baryBary[Y] - (pVarR[P]   - pVarL[P])   / aSide->baryBaryDist
+	};
+	gradUx[RHO] = gradUxMean[RHO] - correction[RHO] * baryBary[X];
+	gradUx[VX]  = gradUxMean[VX]  - correction[VX]  * baryBary[X];
+	gradUx[VY]  = gradUxMean[VY]  - correction[VY]  * baryBary[X];
+	gradUx[P]   = gradUxMean[P]   - correction[P]   * baryBary[X];
+
+	gradUy[RHO] = gradUyMean[RHO] - correction[RHO] * baryBary[Y];
+	gradUy[VX]  = gradUyMean[VX]  - correction[VX]  * baryBary[Y];
+	gradUy[VY]  = gradUyMean[VY]  - correction[VY]  * baryBary[Y];
+	gradUy[P]   = gradUyMean[P]   - correction[P]   * baryBary[Y];
+}
+#endif
+
+/**
+ * \brief Extrapolate the state of an element to the Gaussian point of a side
+ * \param[in] aSide A pointer to the side
+ * \param[out] pVarSide The primitive state at the side
+ */
+void NAME(sideState)(side_t *aSide, real pVarSide[NVAR])
+{
+	long iElem = aSide->elem - elemBlock;
+	real *pVar = STATE.pVar[iElem];
+	real *u_x = STATE.u_x[iElem];
+	real *u_y = STATE.u_y[iElem];
+	double dx = sideData.GP[aSide->id][X];
+	double dy = sideData.GP[aSide->id][Y];
+
+	pVarSide[RHO] = pVar[RHO] + dx * u_x[RHO] + dy * u_y[RHO];
+	pVarSide[VX]  = pVar[VX]  + dx * u_x[VX]  + dy * u_y[VX];
+	pVarSide[VY]  = pVar[VY]  + dx * u_x[VY]  + dy * u_y[VY];
+	pVarSide[P]   = pVar[P]   + dx * u_x[P]   + dy * u_y[P];
+}
+
+/**
+ * \brief Apply the boundary condition at the ghost side of a BC face
+ * \param[in] gSide A pointer to the ghost side
+ * \param[in] time Calculation time
+ * \param[in] pVarInner The primitive state at the inner side
+ * \param[out] pVarGhost The primitive state at the ghost side
+ */
+void NAME(ghostState)(side_t *gSide, double time, real pVarInner[NVAR],
+		real pVarGhost[NVAR])
+{
+	side_t *aSide = gSide->connection;
+	elem_t *aElem = aSide->elem;
+	double *GP = sideData.GP[aSide->id];
+
+	double x[NDIM];
+	x[X] = GP[X] + aElem->bary[X];
+	x[Y] = GP[Y] + aElem->bary[Y];
+
+	NAME(boundary)(gSide, time, pVarInner, pVarGhost, x);
+}
+
+/**
+ * \brief Determine the primitive states at both sides of a face
+ * \param[in] aSide A pointer to the side of the face listed in `side`
+ * \param[in] time Calculation time
+ * \param[out] pVarL The primitive state at `aSide`
+ * \param[out] pVarR The primitive state at the connection of `aSide`
+ */
+void NAME(faceStates)(side_t *aSide, double time, real pVarL[NVAR],
+		real pVarR[NVAR])
+{
+	side_t *bSide = aSide->connection;
+	if (aSide->elem - elemBlock >= nElems) {
+		NAME(sideState)(bSide, pVarR);
+		NAME(ghostState)(aSide, time, pVarR, pVarL);
+	} else {
+		NAME(sideState)(aSide, pVarL);
+		if (bSide->elem - elemBlock >= nElems) {
+			NAME(ghostState)(bSide, time, pVarL, pVarR);
+		} else {
+			NAME(sideState)(bSide, pVarR);
+		}
+	}
+}
+
+/**
+ * \brief Extract the left and right states of a batch of sides
+ *
+ * The states are extrapolated from the elements, or set by the boundary
+ * conditions for the ghost sides. The velocity vector is transformed into the
+ * normal system of the cell interfaces, the states are packed per variable.
+ *
+ * \param[in] iStart Index of the first side in the batch
+ * \param[in] nBatch Number of sides in the batch
+ * \param[in] time Calculation time
+ * \param[out] batch The states of the batch
+ */
+void NAME(fluxStates)(long iStart, int nBatch, double time, NAME(fluxBatch_t) *batch)
+{
+	for (int i = 0; i < nBatch; ++i) {
+		side_t *aSide = side[iStart + i];
+		double *n = sideData.n[aSide->id];
+
+		real pVarL[NVAR], pVarR[NVAR];
+		NAME(faceStates)(aSide, time, pVarL, pVarR);
+
+		batch->pVarL[RHO][i] = pVarL[RHO];
+		batch->pVarL[VX][i]  =   n[X] * pVarL[VX] + n[Y] * pVarL[VY];
+		batch->pVarL[VY][i]  = - n[Y] * pVarL[VX] + n[X] * pVarL[VY];
+		batch->pVarL[P][i]   = pVarL[P];
+
+		batch->pVarR[RHO][i] = pVarR[RHO];
+		batch->pVarR[VX][i]  =   n[X] * pVarR[VX] + n[Y] * pVarR[VY];
+		batch->pVarR[VY][i]  = - n[Y] * pVarR[VX] + n[X] * pVarR[VY];
+		batch->pVarR[P][i]   = pVarR[P];
+
+		#ifdef navierstokes
+		batch->pVarMean[RHO][i] = 0.5 * (pVarR[RHO] + pVarL[RHO]);
+		batch->pVarMean[VX][i]  = 0.5 * (pVarR[VX]  + pVarL[VX]);
+		batch->pVarMean[VY][i]  = 0.5 * (pVarR[VY]  + pVarL[VY]);
+		batch->pVarMean[P][i]   = 0.5 * (pVarR[P]   + pVarL[P]);
+		#endif
+	}
+}
+
+/**
+ * \brief Update the flux balance with the fluxes of a batch of sides
+ *
+ * The diffusive fluxes are added for the Navier-Stokes equations, the fluxes
+ * are rotated back into the global coordinate system, integrated over the
+ * sides and added to the flux balance of the element of the side and
+ * subtracted from the one of its connection.
+ *
+ * \param[in] iStart Index of the first side in the batch
+ * \param[in] nBatch Number of sides in the batch
+ * \param[in] batch The states and convective fluxes of the batch
+ */
+void NAME(fluxUpdate)(long iStart, int nBatch, NAME(fluxBatch_t) *batch)
+{
+	for (int i = 0; i < nBatch; ++i) {
+		side_t *aSide = side[iStart + i];
+		long iSideL = aSide->id;
+		double *n = sideData.n[iSideL];
+
+		#ifdef navierstokes
+		real stateMean[NVAR] = {
+			batch->pVarMean[RHO][i],
+			batch->pVarMean[VX][i],
+			batch->pVarMean[VY][i],
+			batch->pVarMean[P][i]
+		};
+		real gradUx[NVAR], gradUy[NVAR];
+		NAME(sideGradients)(aSide, gradUx, gradUy);
+
+		real fluxDiffX[4] = {0.0}, fluxDiffY[4] = {0.0};
+		NAME(diffusionFlux)(stateMean, gradUx, gradUy, fluxDiffX, fluxDiffY);
+		#endif
+
+		/* rotate flux into global coordinate system and update residual */
+		real flux[NVAR];
+		flux[RHO] = batch->fluxConv[RHO][i];
+		flux[MX]  = n[X] * batch->fluxConv[MX][i] - n[Y] * batch->fluxConv[MY][i];
+		flux[MY]  = n[Y] * batch->fluxConv[MX][i] + n[X] * batch->fluxConv[MY][i];
+		flux[E]   = batch->fluxConv[E][i];
+
+		#ifdef navierstokes
+		/* sum up diffusion part of the fluxes */
+		flux[RHO] -= (fluxDiffX[RHO] * n[X] + fluxDiffY[RHO] * n[Y]);
+		flux[MX]  -= (fluxDiffX[MX]  * n[X] + fluxDiffY[MX]  * n[Y]);
+		flux[MY]  -= (fluxDiffX[MY]  * n[X] + fluxDiffY[MY]  * n[Y]);
+		flux[E]   -= (fluxDiffX[E]   * n[X] + fluxDiffY[E]   * n[Y]);
+		#endif
+
+		/* integrate flux over edge using the midpoint rule */
+		double len = sideData.len[iSideL];
+		flux[RHO] *= len;
+		flux[MX]  *= len;
+		flux[MY]  *= len;
+		flux[E]   *= len;
+
+		/* scatter flux into the flux balance of both elements */
+		real *u_tL = STATE.u_t[aSide->elem - elemBlock];
+		u_tL[RHO] += flux[RHO];
+		u_tL[MX]  += flux[MX];
+		u_tL[MY]  += flux[MY];
+		u_tL[E]   += flux[E];
+
+		real *u_tR = STATE.u_t[aSide->connection->elem - elemBlock];
+		u_tR[RHO] -= flux[RHO];
+		u_tR[MX]  -= flux[MX];
+		u_tR[MY]  -= flux[MY];
+		u_tR[E]   -= flux[E];
+	}
+}
+
+/**
+ * \brief Generate the flux calculation for a flux function
+ *
+ * Each flux function gets its own side loop, so that the flux function is
+ * selected once in `initFV` and can be inlined into the loop. The sides are
+ * processed in batches of `FLUX_BATCH`, the states of a batch are packed per
+ * variable, so that the flux functions can work on all sides of the batch at
+ * once. The fluxes are scattered into the flux balance `u_t` of the elements,
+ * the face blocks of one color are processed in parallel.
+ */
+#define FLUX_CALCULATION(ID, name) \
+void NAME(fluxCalculation_##name)(double time) \
+{ \
+	memset(STATE.u_t, 0, elemData.nElems * sizeof(real[NVAR])); \
+ \
+	_Pragma("omp parallel") \
+	for (long iColor = 0; iColor < nFaceColors; ++iColor) { \
+		_Pragma("omp for") \
+		for (long k = colorBlockStart[iColor]; k < colorBlockStart[iColor + 1]; ++k) { \
+			long iBlock = colorBlock[k]; \
+			long iEnd = ((iBlock + 1) * faceBlockSize < nSides ? \
+					(iBlock + 1) * faceBlockSize : nSides); \
+			for (long iStart = iBlock * faceBlockSize; iStart < iEnd; iStart += FLUX_BATCH) { \
+				int nBatch = ((iEnd - iStart < FLUX_BATCH) ? \
+						iEnd - iStart : FLUX_BATCH); \
+ \
+				NAME(fluxBatch_t) batch; \
+				NAME(fluxStates)(iStart, nBatch, time, &batch); \
+				NAME(flux_##name##_batch)(nBatch, batch.pVarL, batch.pVarR, batch.fluxConv); \
+				NAME(fluxUpdate)(iStart, nBatch, &batch); \
+			} \
+		} \
+	} \
+}
+
+#ifdef DUAL_NUMBERS
+DUAL_FLUX_FUNCTIONS(FLUX_CALCULATION)
+#else
+FLUX_FUNCTIONS(FLUX_CALCULATION)
+#endif
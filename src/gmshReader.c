@@ -0,0 +1,828 @@
+/** \file
+ *
+ * \brief Reader for gmsh mesh files
+ *
+ * The mesh file is mapped into memory and its sections are processed in a
+ * single pass. ASCII and binary files of the formats 2.2 and 4.1 are
+ * supported. The positions of all nodes and elements in the file are
+ * determined first, the numbers themselves are then parsed in parallel.
+ *
+ * \author hhh
+ * \date Sun 18 Oct 2026 10:12:41 AM CEST
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+typedef struct gmshFile_t gmshFile_t;
+typedef struct gmshElem_t gmshElem_t;
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdbool.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "main.h"
+#include "gmshReader.h"
+#include "mesh.h"
+#include "memTools.h"
+
+/**
+ * \brief Mapped gmsh file and its format
+ */
+struct gmshFile_t {
+	const char *data;		/**< content of the file */
+	const char *end;		/**< end of the file content */
+	int version;			/**< major format version, 2 or 4 */
+	bool isBinary;			/**< flag for binary files */
+	long nCurves;			/**< number of curve entities */
+	long *curveId;			/**< tags of the curve entities */
+	int *curveTag;			/**< physical tags of the curve entities */
+};
+
+/**
+ * \brief Position and destination of a single element in the file
+ */
+struct gmshElem_t {
+	const char *pos;		/**< position of the element's node IDs */
+	int type;			/**< element type: BC edge (1), triangle
+						(2), quadrangle (3) or unused (0) */
+	int tag;			/**< physical tag of the element */
+	long dest;			/**< index in the BC edge, triangle or
+						quadrangle array */
+};
+
+/**
+ * \brief Abort on a malformed mesh file
+ */
+void gmshReadError(void)
+{
+	printf("| ERROR: Reading error in gmsh file\n");
+	exit(1);
+}
+
+/**
+ * \brief Return the start of the next line
+ * \param[in] p Position in the file
+ * \param[in] end End of the file content
+ * \return Position after the next line break
+ */
+const char *gmshNextLine(const char *p, const char *end)
+{
+	const char *lineEnd = memchr(p, '\n', end - p);
+	return (lineEnd ? lineEnd + 1 : end);
+}
+
+/**
+ * \brief Parse an integer in an ASCII file
+ * \param[in,out] p Position in the file, moved behind the number
+ * \param[in] end End of the file content
+ * \return The integer
+ */
+long gmshParseLong(const char **p, const char *end)
+{
+	const char *q = *p;
+	while ((q < end) && ((*q == ' ') || (*q == '\t') || (*q == '\r'))) {
+		q++;
+	}
+
+	bool isNegative = ((q < end) && (*q == '-'));
+	if ((q < end) && ((*q == '-') || (*q == '+'))) {
+		q++;
+	}
+
+	if ((q >= end) || (*q < '0') || (*q > '9')) {
+		gmshReadError();
+	}
+
+	long val = 0;
+	while ((q < end) && (*q >= '0') && (*q <= '9')) {
+		val = 10 * val + (*q - '0');
+		q++;
+	}
+
+	*p = q;
+	return (isNegative ? -val : val);
+}
+
+/**
+ * \brief Parse a floating point number in an ASCII file
+ *
+ * strtod is only called directly if a white space follows the number inside
+ * the file, otherwise the number at the end of the file is copied first.
+ *
+ * \param[in,out] p Position in the file, moved behind the number
+ * \param[in] end End of the file content
+ * \return The number
+ */
+double gmshParseDbl(const char **p, const char *end)
+{
+	const char *q = *p;
+	while ((q < end) && isspace((unsigned char)*q)) {
+		q++;
+	}
+
+	const char *tokenEnd = q;
+	while ((tokenEnd < end) && !isspace((unsigned char)*tokenEnd)) {
+		tokenEnd++;
+	}
+	if (tokenEnd == q) {
+		gmshReadError();
+	}
+
+	char *r;
+	double val;
+	if (tokenEnd < end) {
+		val = strtod(q, &r);
+	} else {
+		char buf[STRLEN];
+		size_t len = tokenEnd - q;
+		if (len >= STRLEN) {
+			gmshReadError();
+		}
+		memcpy(buf, q, len);
+		buf[len] = '\0';
+		val = strtod(buf, &r);
+		r = (char *)q + (r - buf);
+	}
+	if (r == q) {
+		gmshReadError();
+	}
+
+	*p = r;
+	return val;
+}
+
+/**
+ * \brief Read an integer from a binary file
+ * \param[in] p Position in the file, not necessarily aligned
+ * \return The integer
+ */
+int gmshBinInt(const char *p)
+{
+	int val;
+	memcpy(&val, p, sizeof(int));
+	return val;
+}
+
+/**
+ * \brief Read a size_t from a binary file
+ * \param[in] p Position in the file, not necessarily aligned
+ * \return The number
+ */
+long gmshBinSize(const char *p)
+{
+	size_t val;
+	memcpy(&val, p, sizeof(size_t));
+	return val;
+}
+
+/**
+ * \brief Read a double from a binary file
+ * \param[in] p Position in the file, not necessarily aligned
+ * \return The number
+ */
+double gmshBinDbl(const char *p)
+{
+	double val;
+	memcpy(&val, p, sizeof(double));
+	return val;
+}
+
+/**
+ * \brief Read a node ID of an element
+ * \param[in] file Pointer to the gmsh file
+ * \param[in,out] p Position in the file, moved behind the ID
+ * \return The node ID
+ */
+long gmshReadNodeId(const gmshFile_t *file, const char **p)
+{
+	long id;
+	if (!file->isBinary) {
+		id = gmshParseLong(p, file->end);
+	} else if (file->version == 2) {
+		id = gmshBinInt(*p);
+		*p += sizeof(int);
+	} else {
+		id = gmshBinSize(*p);
+		*p += sizeof(size_t);
+	}
+	return id;
+}
+
+/**
+ * \brief Number of nodes of the gmsh element types
+ * \param[in] type gmsh element type
+ * \return Number of nodes
+ */
+int gmshNodesPerElem(int type)
+{
+	const int nNodes[32] = {0, 2, 3, 4, 4, 8, 6, 5, 3, 6, 9, 10, 27, 18, 14,
+		1, 8, 20, 15, 13, 9, 10, 12, 15, 15, 21, 4, 5, 6, 20, 35, 56};
+
+	if ((type < 1) || (type > 31)) {
+		printf("| ERROR: Unknown gmsh element type %d\n", type);
+		exit(1);
+	}
+	return nNodes[type];
+}
+
+/**
+ * \brief Check if the line at a position starts a section
+ * \param[in] p Position of the '$' sign
+ * \param[in] end End of the file content
+ * \param[in] name Name of the section, without the '$' sign
+ * \return True if the section name matches
+ */
+bool gmshIsSection(const char *p, const char *end, const char *name)
+{
+	size_t len = strlen(name);
+	if ((size_t)(end - p) < len + 2) {
+		return false;
+	}
+	return (!strncmp(p + 1, name, len) &&
+		((p[len + 1] == '\n') || (p[len + 1] == '\r')));
+}
+
+/**
+ * \brief Find the end of a section
+ * \param[in] p Position inside the section
+ * \param[in] end End of the file content
+ * \param[in] name Name of the section end, e.g. "EndNodes"
+ * \return Position after the section end
+ */
+const char *gmshEndSection(const char *p, const char *end, const char *name)
+{
+	while (p < end) {
+		p = memchr(p, '$', end - p);
+		if (!p) {
+			break;
+		}
+		if (gmshIsSection(p, end, name)) {
+			return gmshNextLine(p, end);
+		}
+		p++;
+	}
+
+	printf("| ERROR: Missing '$%s' in gmsh file\n", name);
+	exit(1);
+}
+
+/**
+ * \brief Read the mesh format section
+ * \param[in,out] file Pointer to the gmsh file
+ * \param[in] p Position after the section header
+ * \return Position after the section end
+ */
+const char *gmshReadFormat(gmshFile_t *file, const char *p)
+{
+	double version = gmshParseDbl(&p, file->end);
+	file->isBinary = gmshParseLong(&p, file->end);
+	long dataSize = gmshParseLong(&p, file->end);
+	p = gmshNextLine(p, file->end);
+
+	if ((version >= 2.0) && (version < 3.0)) {
+		file->version = 2;
+	} else if (version == 4.1) {
+		file->version = 4;
+	} else {
+		printf("| ERROR: Wrong gmsh Mesh Format '%g'\n", version);
+		exit(1);
+	}
+
+	if (file->isBinary) {
+		if (dataSize != sizeof(size_t)) {
+			printf("| ERROR: Binary gmsh files need a data size of %zu\n",
+					sizeof(size_t));
+			exit(1);
+		}
+
+		if (gmshBinInt(p) != 1) {
+			printf("| ERROR: Binary gmsh file has a different byte order\n");
+			exit(1);
+		}
+		p += sizeof(int);
+	}
+
+	return gmshEndSection(p, file->end, "EndMeshFormat");
+}
+
+/**
+ * \brief Read the physical tags of the curve entities (format 4.1)
+ * \param[in,out] file Pointer to the gmsh file
+ * \param[in] p Position after the section header
+ * \return Position after the section end
+ */
+const char *gmshReadEntities(gmshFile_t *file, const char *p)
+{
+	long nPoints;
+	if (!file->isBinary) {
+		nPoints = gmshParseLong(&p, file->end);
+		file->nCurves = gmshParseLong(&p, file->end);
+		p = gmshNextLine(p, file->end);
+	} else {
+		nPoints = gmshBinSize(p);
+		file->nCurves = gmshBinSize(p + sizeof(size_t));
+		p += 4 * sizeof(size_t);
+	}
+
+	if (file->nCurves == 0) {
+		printf("| ERROR: No curves in mesh file\n");
+		exit(1);
+	}
+
+	file->curveId = malloc(file->nCurves * sizeof(long));
+	file->curveTag = malloc(file->nCurves * sizeof(int));
+	if (!file->curveId || !file->curveTag) {
+		printf("| ERROR: could not allocate curve tags\n");
+		exit(1);
+	}
+
+	/* skip the points */
+	for (long iPoint = 0; iPoint < nPoints; ++iPoint) {
+		if (!file->isBinary) {
+			p = gmshNextLine(p, file->end);
+		} else {
+			p += sizeof(int) + 3 * sizeof(double);
+			p += sizeof(size_t) + gmshBinSize(p) * sizeof(int);
+		}
+	}
+
+	/* curve tag, bounding box and physical tags */
+	for (long iCurve = 0; iCurve < file->nCurves; ++iCurve) {
+		long nPhysicalTags;
+		if (!file->isBinary) {
+			file->curveId[iCurve] = gmshParseLong(&p, file->end);
+			for (int i = 0; i < 6; ++i) {
+				gmshParseDbl(&p, file->end);
+			}
+			nPhysicalTags = gmshParseLong(&p, file->end);
+			file->curveTag[iCurve] = (nPhysicalTags ? gmshParseLong(&p, file->end) : 0);
+			p = gmshNextLine(p, file->end);
+		} else {
+			file->curveId[iCurve] = gmshBinInt(p);
+			p += sizeof(int) + 6 * sizeof(double);
+			nPhysicalTags = gmshBinSize(p);
+			p += sizeof(size_t);
+			file->curveTag[iCurve] = (nPhysicalTags ? gmshBinInt(p) : 0);
+			p += nPhysicalTags * sizeof(int);
+			p += sizeof(size_t) + gmshBinSize(p) * sizeof(int);
+		}
+	}
+
+	return gmshEndSection(p, file->end, "EndEntities");
+}
+
+/**
+ * \brief Read the nodes
+ * \param[in] file Pointer to the gmsh file
+ * \param[in] p Position after the section header
+ * \param[in,out] vertex Pointer to 2D array, used for the vertices
+ * \param[in,out] nVertices Pointer to the number of total vertices in `vertex`
+ * \return Position after the section end
+ */
+const char *gmshReadNodes(gmshFile_t *file, const char *p, double ***vertex,
+		long *nVertices)
+{
+	long nBlocks = 1;
+	if (file->version == 2) {
+		*nVertices = gmshParseLong(&p, file->end);
+		p = gmshNextLine(p, file->end);
+	} else if (!file->isBinary) {
+		nBlocks = gmshParseLong(&p, file->end);
+		*nVertices = gmshParseLong(&p, file->end);
+		p = gmshNextLine(p, file->end);
+	} else {
+		nBlocks = gmshBinSize(p);
+		*nVertices = gmshBinSize(p + sizeof(size_t));
+		p += 4 * sizeof(size_t);
+	}
+
+	if (*nVertices <= 0) {
+		printf("| ERROR: No Nodes in Mesh file\n");
+		exit(1);
+	}
+
+	/* positions of the coordinates, node IDs are checked on the way */
+	const char **xPos = malloc(*nVertices * sizeof(char *));
+	if (!xPos) {
+		printf("| ERROR: could not allocate xPos\n");
+		exit(1);
+	}
+
+	long iVert = 0;
+	for (long iBlock = 0; iBlock < nBlocks; ++iBlock) {
+		long nInBlock = *nVertices, stride = 0;
+		if ((file->version == 4) && !file->isBinary) {
+			gmshParseLong(&p, file->end);
+			gmshParseLong(&p, file->end);
+			gmshParseLong(&p, file->end);
+			nInBlock = gmshParseLong(&p, file->end);
+			p = gmshNextLine(p, file->end);
+		} else if (file->version == 4) {
+			int dim = gmshBinInt(p);
+			int isParametric = gmshBinInt(p + 2 * sizeof(int));
+			nInBlock = gmshBinSize(p + 3 * sizeof(int));
+			p += 3 * sizeof(int) + sizeof(size_t);
+			stride = (3 + (isParametric ? dim : 0)) * sizeof(double);
+		}
+
+		if (iVert + nInBlock > *nVertices) {
+			gmshReadError();
+		}
+
+		for (long i = 0; i < nInBlock; ++i) {
+			long id;
+			if (!file->isBinary) {
+				id = gmshParseLong(&p, file->end);
+				if (file->version == 2) {
+					xPos[iVert + i] = p;
+				}
+				p = gmshNextLine(p, file->end);
+			} else if (file->version == 2) {
+				id = gmshBinInt(p);
+				xPos[iVert + i] = p + sizeof(int);
+				p += sizeof(int) + 3 * sizeof(double);
+			} else {
+				id = gmshBinSize(p);
+				p += sizeof(size_t);
+			}
+
+			if (id != iVert + i + 1) {
+				printf("| ERROR: NodeID %ld does not match Node Position\n", id);
+				exit(1);
+			}
+		}
+
+		/* format 4.1: coordinates follow the IDs of the block */
+		if (file->version == 4) {
+			for (long i = 0; i < nInBlock; ++i) {
+				xPos[iVert + i] = p;
+				if (!file->isBinary) {
+					p = gmshNextLine(p, file->end);
+				} else {
+					p += stride;
+				}
+			}
+		}
+
+		iVert += nInBlock;
+	}
+
+	if (iVert != *nVertices) {
+		gmshReadError();
+	}
+
+	*vertex = dyn2DdblArray(*nVertices, 2);
+
+	#pragma omp parallel for
+	for (long iVert = 0; iVert < *nVertices; ++iVert) {
+		const char *q = xPos[iVert];
+		if (!file->isBinary) {
+			(*vertex)[iVert][X] = gmshParseDbl(&q, file->end);
+			(*vertex)[iVert][Y] = gmshParseDbl(&q, file->end);
+		} else {
+			(*vertex)[iVert][X] = gmshBinDbl(q);
+			(*vertex)[iVert][Y] = gmshBinDbl(q + sizeof(double));
+		}
+	}
+
+	free(xPos);
+
+	return gmshEndSection(p, file->end, "EndNodes");
+}
+
+/**
+ * \brief Classify an element of an ASCII file in format 2.2
+ * \param[in,out] aElem Pointer to the element, its position is moved from
+ *	the start of the line to the node IDs
+ * \param[in] end End of the file content
+ */
+void gmshClassifyElem(gmshElem_t *aElem, const char *end)
+{
+	const char *p = aElem->pos;
+
+	/* element ID, type and tags, the first tag is the physical group */
+	gmshParseLong(&p, end);
+	int type = gmshParseLong(&p, end);
+	int nTags = gmshParseLong(&p, end);
+	int pGroup = 0;
+	for (int iTag = 0; iTag < nTags; ++iTag) {
+		long tag = gmshParseLong(&p, end);
+		if (iTag == 0) {
+			pGroup = tag;
+		}
+	}
+
+	aElem->pos = p;
+	aElem->tag = pGroup;
+	if ((type == 1) && (pGroup > 100)) {
+		aElem->type = 1;
+	} else if ((type == 2) || (type == 3)) {
+		aElem->type = type;
+	} else {
+		aElem->type = 0;
+	}
+}
+
+/**
+ * \brief Read the elements
+ * \param[in] file Pointer to the gmsh file
+ * \param[in] p Position after the section header
+ * \param[in,out] BCedge Pointer to 2D array, used for the BC edges
+ * \param[in,out] nBCedges Pointer to the number of total BC edges
+ * \param[in,out] tria Pointer to a 2D array, used for the triangles
+ * \param[in,out] quad Pointer to a 2D array, used for the quadrangles
+ * \return Position after the section end
+ */
+const char *gmshReadElements(gmshFile_t *file, const char *p, long ***BCedge,
+		long *nBCedges, long ***tria, long ***quad)
+{
+	long nBlocks = 0, nElem;
+	if (file->version == 2) {
+		nElem = gmshParseLong(&p, file->end);
+		p = gmshNextLine(p, file->end);
+	} else if (!file->isBinary) {
+		nBlocks = gmshParseLong(&p, file->end);
+		nElem = gmshParseLong(&p, file->end);
+		p = gmshNextLine(p, file->end);
+	} else {
+		nBlocks = gmshBinSize(p);
+		nElem = gmshBinSize(p + sizeof(size_t));
+		p += 4 * sizeof(size_t);
+	}
+
+	if (nElem <= 0) {
+		printf("| ERROR: No Elements in Mesh file\n");
+		exit(1);
+	}
+
+	gmshElem_t *elems = malloc(nElem * sizeof(gmshElem_t));
+	if (!elems) {
+		printf("| ERROR: could not allocate elems\n");
+		exit(1);
+	}
+
+	/* positions of the elements */
+	long iElem = 0;
+	if (file->version == 2 && !file->isBinary) {
+		for (iElem = 0; iElem < nElem; ++iElem) {
+			elems[iElem].pos = p;
+			p = gmshNextLine(p, file->end);
+		}
+
+		#pragma omp parallel for
+		for (long iElem = 0; iElem < nElem; ++iElem) {
+			gmshClassifyElem(&elems[iElem], file->end);
+		}
+	} else if (file->version == 2) {
+		while (iElem < nElem) {
+			int type = gmshBinInt(p);
+			long nInBlock = gmshBinInt(p + sizeof(int));
+			int nTags = gmshBinInt(p + 2 * sizeof(int));
+			p += 3 * sizeof(int);
+
+			if (iElem + nInBlock > nElem) {
+				gmshReadError();
+			}
+
+			long recordSize = (1 + nTags + gmshNodesPerElem(type)) * sizeof(int);
+			for (long i = 0; i < nInBlock; ++i) {
+				gmshElem_t *aElem = &elems[iElem++];
+				aElem->tag = (nTags > 0 ? gmshBinInt(p + sizeof(int)) : 0);
+				aElem->pos = p + (1 + nTags) * sizeof(int);
+				if ((type == 1) && (aElem->tag > 100)) {
+					aElem->type = 1;
+				} else if ((type == 2) || (type == 3)) {
+					aElem->type = type;
+				} else {
+					aElem->type = 0;
+				}
+				p += recordSize;
+			}
+		}
+	} else {
+		for (long iBlock = 0; iBlock < nBlocks; ++iBlock) {
+			int entityTag, type;
+			long nInBlock;
+			if (!file->isBinary) {
+				gmshParseLong(&p, file->end);
+				entityTag = gmshParseLong(&p, file->end);
+				type = gmshParseLong(&p, file->end);
+				nInBlock = gmshParseLong(&p, file->end);
+				p = gmshNextLine(p, file->end);
+			} else {
+				entityTag = gmshBinInt(p + sizeof(int));
+				type = gmshBinInt(p + 2 * sizeof(int));
+				nInBlock = gmshBinSize(p + 3 * sizeof(int));
+				p += 3 * sizeof(int) + sizeof(size_t);
+			}
+
+			if (iElem + nInBlock > nElem) {
+				gmshReadError();
+			}
+
+			/* boundary edges get the physical tag of their curve,
+			 * all triangles and quadrangles are in domain 1 */
+			int tag = 1;
+			if (type == 1) {
+				tag = 0;
+				for (long iCurve = 0; iCurve < file->nCurves; ++iCurve) {
+					if (file->curveId[iCurve] == entityTag) {
+						tag = file->curveTag[iCurve];
+					}
+				}
+			}
+
+			long recordSize = (file->isBinary ?
+				(1 + gmshNodesPerElem(type)) * sizeof(size_t) : 0);
+			for (long i = 0; i < nInBlock; ++i) {
+				gmshElem_t *aElem = &elems[iElem++];
+				aElem->type = ((type >= 1) && (type <= 3) ? type : 0);
+				aElem->tag = tag;
+				if (!file->isBinary) {
+					gmshParseLong(&p, file->end);
+					aElem->pos = p;
+					p = gmshNextLine(p, file->end);
+				} else {
+					aElem->pos = p + sizeof(size_t);
+					p += recordSize;
+				}
+			}
+		}
+	}
+
+	if (iElem != nElem) {
+		gmshReadError();
+	}
+
+	/* destination of every element, in the order of the file */
+	*nBCedges = nTrias = nQuads = 0;
+	for (long iElem = 0; iElem < nElem; ++iElem) {
+		switch (elems[iElem].type) {
+		case 1:
+			elems[iElem].dest = (*nBCedges)++;
+			break;
+		case 2:
+			elems[iElem].dest = nTrias++;
+			break;
+		case 3:
+			elems[iElem].dest = nQuads++;
+			break;
+		}
+	}
+
+	*BCedge = dyn2DintArray(*nBCedges, 3);
+	if (nTrias > 0) {
+		*tria = dyn2DintArray(nTrias, 4);
+	}
+	if (nQuads > 0) {
+		*quad = dyn2DintArray(nQuads, 5);
+	}
+
+	/* node IDs */
+	#pragma omp parallel for
+	for (long iElem = 0; iElem < nElem; ++iElem) {
+		gmshElem_t *aElem = &elems[iElem];
+		const char *q = aElem->pos;
+		long *conn;
+
+		switch (aElem->type) {
+		case 1:
+			conn = (*BCedge)[aElem->dest];
+			conn[0] = gmshReadNodeId(file, &q) - 1;
+			conn[1] = gmshReadNodeId(file, &q) - 1;
+			conn[2] = aElem->tag;
+			break;
+		case 2:
+			conn = (*tria)[aElem->dest];
+			conn[0] = gmshReadNodeId(file, &q) - 1;
+			conn[1] = gmshReadNodeId(file, &q) - 1;
+			conn[2] = gmshReadNodeId(file, &q) - 1;
+			conn[3] = aElem->tag;
+			break;
+		case 3:
+			conn = (*quad)[aElem->dest];
+			conn[0] = gmshReadNodeId(file, &q) - 1;
+			conn[1] = gmshReadNodeId(file, &q) - 1;
+			conn[2] = gmshReadNodeId(file, &q) - 1;
+			conn[3] = gmshReadNodeId(file, &q) - 1;
+			conn[4] = aElem->tag;
+			break;
+		}
+	}
+
+	free(elems);
+
+	return gmshEndSection(p, file->end, "EndElements");
+}
+
+/**
+ * \brief Read in gmsh mesh file
+ * \param[in] fileName Name of the mesh file
+ * \param[in,out] vertex Pointer to 2D array, used for the vertices
+ * \param[in,out] nVertices Pointer to the number of total vertices in `vertex`
+ * \param[in,out] BCedge Pointer to 2D array, used for the BC edges
+ * \param[in,out] nBCedges Pointer to the number of total BC edges
+ * \param[in,out] tria Pointer to a 2D array, used for the triangles
+ * \param[in,out] quad Pointer to a 2D array, used for the quadrangles
+ */
+void readGmsh(char fileName[STRLEN], double ***vertex, long *nVertices, long ***BCedge,
+		long *nBCedges, long ***tria, long ***quad)
+{
+	/* map the mesh file into memory */
+	int fd = open(fileName, O_RDONLY);
+	if (fd < 0) {
+		printf("| ERROR: Could not find Mesh File '%s'\n", fileName);
+		exit(1);
+	}
+
+	struct stat fileStat;
+	if (fstat(fd, &fileStat) || (fileStat.st_size == 0)) {
+		printf("| ERROR: Could not read Mesh File '%s'\n", fileName);
+		exit(1);
+	}
+
+	size_t size = fileStat.st_size;
+	char *data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (data == MAP_FAILED) {
+		printf("| ERROR: Could not map Mesh File '%s'\n", fileName);
+		exit(1);
+	}
+	close(fd);
+
+	gmshFile_t file = {
+		.data = data,
+		.end = data + size,
+		.version = 0,
+		.isBinary = false,
+		.nCurves = 0,
+		.curveId = NULL,
+		.curveTag = NULL
+	};
+
+	/* process all sections in the order of the file */
+	*nVertices = 0;
+	*nBCedges = nTrias = nQuads = 0;
+	bool hasElements = false;
+	const char *p = file.data;
+	while (p < file.end) {
+		if (*p != '$') {
+			p = gmshNextLine(p, file.end);
+		} else if (gmshIsSection(p, file.end, "MeshFormat")) {
+			p = gmshReadFormat(&file, gmshNextLine(p, file.end));
+		} else if (file.version == 0) {
+			break;
+		} else if (gmshIsSection(p, file.end, "Entities") &&
+			   (file.version == 4)) {
+			p = gmshReadEntities(&file, gmshNextLine(p, file.end));
+		} else if (gmshIsSection(p, file.end, "Nodes")) {
+			p = gmshReadNodes(&file, gmshNextLine(p, file.end),
+					vertex, nVertices);
+		} else if (gmshIsSection(p, file.end, "Elements")) {
+			if ((file.version == 4) && (file.nCurves == 0)) {
+				printf("| ERROR: No curves in mesh file\n");
+				exit(1);
+			}
+			p = gmshReadElements(&file, gmshNextLine(p, file.end),
+					BCedge, nBCedges, tria, quad);
+			hasElements = true;
+		} else {
+			/* skip unused sections */
+			char endName[STRLEN] = "End";
+			const char *nameEnd = p + 1;
+			while ((nameEnd < file.end) && (*nameEnd != '\n') &&
+			       (*nameEnd != '\r') && (nameEnd - p < STRLEN - 4)) {
+				nameEnd++;
+			}
+			strncat(endName, p + 1, nameEnd - p - 1);
+			p = gmshEndSection(gmshNextLine(p, file.end), file.end, endName);
+		}
+	}
+
+	if (file.version == 0) {
+		printf("| ERROR: No Mesh Format in gmsh file\n");
+		exit(1);
+	}
+	if (*nVertices == 0) {
+		printf("| ERROR: No Nodes in Mesh file\n");
+		exit(1);
+	}
+	if (!hasElements) {
+		printf("| ERROR: No Elements in Mesh file\n");
+		exit(1);
+	}
+
+	free(file.curveId);
+	free(file.curveTag);
+	munmap(data, size);
+
+	printf("| %7ld Nodes read\n", *nVertices);
+	printf("| %7ld Triangles read\n", nTrias);
+	printf("| %7ld Quadrangles read\n", nQuads);
+	printf("| %7ld Boundary Edges read\n", *nBCedges);
+}
@@ -0,0 +1,15 @@
+/** \file
+ *
+ * \author hhh
+ * \date Sun 18 Oct 2026 10:12:41 AM CEST
+ */
+
+#ifndef GMSHREADER_H
+#define GMSHREADER_H
+
+#include "main.h"
+
+void readGmsh(char fileName[STRLEN], double ***vertex, long *nVertices, long ***BCedge,
+		long *nBCedges, long ***tria, long ***quad);
+
+#endif
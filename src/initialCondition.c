@@ -142,10 +142,10 @@ void cgnsReadSolution(void)
 	/* save CGNS solution into mesh */
 	elem_t *aElem = firstElem;
 	while (aElem) {
-		aElem->pVar[RHO] = rhoArr[aElem->id];
-		aElem->pVar[VX]  = vxArr[aElem->id];
-		aElem->pVar[VY]  = vyArr[aElem->id];
-		aElem->pVar[P]   = pArr[aElem->id];
+		aElem->pVar[RHO] = rhoArr[aElem->fileId];
+		aElem->pVar[VX]  = vxArr[aElem->fileId];
+		aElem->pVar[VY]  = vyArr[aElem->fileId];
+		aElem->pVar[P]   = pArr[aElem->fileId];
 
 		aElem = aElem->next;
 	}
@@ -172,7 +172,7 @@ void setInitialCondition(void)
 			/* cell test */
 			aElem = firstElem;
 			while (aElem) {
-				aElem->pVar[RHO] = 1.0 * aElem->id;
+				aElem->pVar[RHO] = 1.0 * aElem->fileId;
 				aElem->pVar[VX] = 0.0;
 				aElem->pVar[VY] = 0.0;
 				aElem->pVar[P] = 1.0;
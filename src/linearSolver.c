@@ -23,6 +23,11 @@
 #include "fluxCalculation.h"
 #include "equationOfState.h"
 #include "finiteVolume.h"
+#include "dualNumber.h"
+#include "equation.h"
+
+/* complex.h defines I, which memTools.h uses as a parameter name */
+#include <complex.h>
 
 /* extern variables */
 int nKdim;			/**< number Krylov spaces */
@@ -30,6 +35,8 @@ int nNewtonIter;		/**< maximum number of Newton iterations */
 int nNewtonIterGlobal;		/**< global number of Newton iterations */
 
 int nGMRESiterGlobal;		/**< global number of GMRES iterations */
+int nGMRESfailGlobal;		/**< global number of GMRES solves that did
+					not reduce the linear residual */
 
 int nInnerNewton;		/**< maximum number of Newton iterations for
 					one stage */
@@ -38,6 +45,10 @@ int nInnerGMRES;		/**< maximum number of GMRES iterations for
 					one stage */
 
 bool usePrecond;		/**< use LUSGS preconditioner flag */
+bool analyticJacobian;		/**< build the preconditioner from the analytic
+					flux Jacobians */
+bool exactMatrixVector;		/**< compute the matrix vector products
+					exactly with dual numbers */
 
 double rEps0;			/**< DBL_EPSILON */
 double srEps0;			/**< sqrt(DBL_EPSILON) */
@@ -52,9 +63,28 @@ double **XK;			/**< kth X vector array */
 double **R_XK;			/**< residual of kth vector array */
 
 /* local variables */
-double ***D;			/**< D-Matrix of LUSGS procedure */
 double ***Dinv;			/**< inverse of D-Matrix */
-double **dRdU;			/**< dR / dU */
+
+long *jacRowStart;		/**< index of the first block of every block row
+					of dR / dU, `nElems + 1` entries */
+long *jacCol;			/**< block column (element ID) of every block */
+long *jacDiag;			/**< index of the diagonal block of every row */
+double ***jacBlock;		/**< NVAR x NVAR blocks of dR / dU */
+long nJacBlocks;		/**< number of non-zero blocks of dR / dU */
+
+int nColors;			/**< number of colors of the element graph */
+long *colorStart;		/**< index of the first element of every color
+					in `colorElem`, `nColors + 1` entries */
+long *colorElem;		/**< element IDs, sorted by color */
+
+int sweepType;			/**< ordering of the LUSGS sweeps */
+long nWaves;			/**< number of waves of the LUSGS sweeps */
+long *waveStart;		/**< index of the first element of every wave
+					in `waveElem`, `nWaves + 1` entries */
+long *waveElem;			/**< element IDs, sorted by wave */
+long *sweepRank;		/**< position of every element in the sweep, an
+					element depends on all its neighbors with
+					lower rank in the forward sweep */
 
 double ***V;			/**< temporary array, used in GMRES */
 double ***Z;			/**< temporary array, used in GMRES */
@@ -62,6 +92,270 @@ double **R0;			/**< temporary array, used in GMRES */
 double **W;			/**< temporary array, used in GMRES */
 double **deltaXstar;		/**< temporary array, used in LUSGS */
 
+/** \brief Create the sparsity pattern of the block Jacobian dR / dU
+ *
+ * The Jacobian is stored in block compressed sparse row format: every row
+ * holds the NVAR x NVAR diagonal block of an element and one block for every
+ * distinct neighbor element. Ghost cells are not part of the system. The
+ * columns of every row are sorted by element ID, such that the lower and upper
+ * parts needed for the LUSGS sweeps are contiguous.
+ */
+void createJacobianPattern(void)
+{
+	jacRowStart = malloc((nElems + 1) * sizeof(long));
+	jacDiag = malloc(nElems * sizeof(long));
+	if (!jacRowStart || !jacDiag) {
+		printf("| ERROR: could not allocate Jacobian pattern\n");
+		exit(1);
+	}
+
+	/* count the blocks of every row, the diagonal block is always present */
+	jacRowStart[0] = 0;
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		long nBlocks = 1 + elemSideStart[iElem + 1] - elemSideStart[iElem];
+		jacRowStart[iElem + 1] = jacRowStart[iElem] + nBlocks;
+	}
+
+	jacCol = malloc(jacRowStart[nElems] * sizeof(long));
+	if (!jacCol) {
+		printf("| ERROR: could not allocate jacCol\n");
+		exit(1);
+	}
+
+	/* fill in the sorted, unique columns of every row and compress */
+	nJacBlocks = 0;
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		long start = nJacBlocks;
+		jacCol[nJacBlocks++] = iElem;
+
+		for (long k = elemSideStart[iElem]; k < elemSideStart[iElem + 1]; ++k) {
+			long jElem = elemNB[k];
+			if (jElem < nElems) {
+				/* sorted insert, skipping duplicate neighbors */
+				long iBlock = nJacBlocks;
+				while ((iBlock > start) && (jacCol[iBlock - 1] > jElem)) {
+					iBlock--;
+				}
+				if ((iBlock == start) || (jacCol[iBlock - 1] != jElem)) {
+					for (long l = nJacBlocks; l > iBlock; --l) {
+						jacCol[l] = jacCol[l - 1];
+					}
+					jacCol[iBlock] = jElem;
+					nJacBlocks++;
+				}
+			}
+		}
+
+		jacRowStart[iElem] = start;
+		for (long k = start; k < nJacBlocks; ++k) {
+			if (jacCol[k] == iElem) {
+				jacDiag[iElem] = k;
+			}
+		}
+	}
+	jacRowStart[nElems] = nJacBlocks;
+
+	jacBlock = dyn3DdblArray(nJacBlocks, NVAR, NVAR);
+
+	printf("| Block Jacobian: %ld Blocks of size %dx%d\n",
+			nJacBlocks, NVAR, NVAR);
+}
+
+/**
+ * \brief Find the block of the Jacobian that couples two elements
+ * \param[in] iElem Element ID of the block row
+ * \param[in] jElem Element ID of the block column
+ * \return Index of the block in `jacBlock`, -1 if it is not part of the pattern
+ */
+long jacobianBlock(long iElem, long jElem)
+{
+	for (long k = jacRowStart[iElem]; k < jacRowStart[iElem + 1]; ++k) {
+		if (jacCol[k] == jElem) {
+			return k;
+		}
+	}
+	return -1;
+}
+
+/** \brief Sort the elements into groups, using a counting sort
+ * \param[in] key Group of every element, between 0 and `nGroups - 1`
+ * \param[in] nGroups Number of groups
+ * \param[out] start Index of the first element of every group in `list`
+ * \param[out] list Element IDs, sorted by group, ascending within a group
+ */
+void groupElems(long *key, long nGroups, long **start, long **list)
+{
+	*start = calloc(nGroups + 1, sizeof(long));
+	*list = malloc(nElems * sizeof(long));
+	if (!*start || !*list) {
+		printf("| ERROR: could not allocate element groups\n");
+		exit(1);
+	}
+
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		(*start)[key[iElem] + 1]++;
+	}
+	for (long i = 0; i < nGroups; ++i) {
+		(*start)[i + 1] += (*start)[i];
+	}
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		(*list)[(*start)[key[iElem]]++] = iElem;
+	}
+	for (long i = nGroups; i > 0; --i) {
+		(*start)[i] = (*start)[i - 1];
+	}
+	(*start)[0] = 0;
+}
+
+/** \brief Color the element graph greedily
+ * \param[in] distance Minimum distance of two elements with the same color,
+ *	one for direct neighbors, two for neighbors of neighbors and so on
+ * \param[out] color Color of every element
+ * \return Number of colors
+ */
+long colorElems(int distance, long *color)
+{
+	long *isForbidden = malloc((nJacBlocks + 1) * sizeof(long));
+	long *isVisited = malloc(nElems * sizeof(long));
+	long *front = malloc(nElems * sizeof(long));
+	if (!isForbidden || !isVisited || !front) {
+		printf("| ERROR: could not allocate coloring arrays\n");
+		exit(1);
+	}
+
+	for (long i = 0; i <= nJacBlocks; ++i) {
+		isForbidden[i] = -1;
+	}
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		isVisited[iElem] = -1;
+	}
+
+	long nColor = 0;
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		/* breadth first search up to the given distance */
+		long nFront = 1, iFront = 0;
+		front[0] = iElem;
+		isVisited[iElem] = iElem;
+		for (int iDist = 0; iDist < distance; ++iDist) {
+			long frontEnd = nFront;
+			for (; iFront < frontEnd; ++iFront) {
+				long jElem = front[iFront];
+				for (long k = jacRowStart[jElem]; k < jacRowStart[jElem + 1]; ++k) {
+					long kElem = jacCol[k];
+					if (isVisited[kElem] == iElem) {
+						continue;
+					}
+					isVisited[kElem] = iElem;
+					front[nFront++] = kElem;
+					if (kElem < iElem) {
+						isForbidden[color[kElem]] = iElem;
+					}
+				}
+			}
+		}
+
+		long iColor = 0;
+		while (isForbidden[iColor] == iElem) {
+			iColor++;
+		}
+		color[iElem] = iColor;
+		nColor = (iColor + 1 > nColor ? iColor + 1 : nColor);
+	}
+
+	free(isForbidden);
+	free(isVisited);
+	free(front);
+
+	return nColor;
+}
+
+/** \brief Color the element graph for the finite difference Jacobian
+ *
+ * All elements of one color are perturbed at once when building the
+ * Jacobian, every residual may thus depend on at most one perturbed element.
+ * For first order the residual of an element only depends on itself and its
+ * direct neighbors, which requires a distance of two. The gradients of the
+ * second order reconstruction and of the viscous fluxes add the neighbors of
+ * the neighbors, the distance is then three, so that every block of the
+ * Jacobian is exact.
+ */
+void createColoring(void)
+{
+	long *color = malloc(nElems * sizeof(long));
+	if (!color) {
+		printf("| ERROR: could not allocate coloring arrays\n");
+		exit(1);
+	}
+
+	int distance = ((spatialOrder == 2) || (mu > 0.0) ? 3 : 2);
+	nColors = colorElems(distance, color);
+	groupElems(color, nColors, &colorStart, &colorElem);
+
+	free(color);
+
+	printf("| Jacobian Coloring: %d Colors, Distance %d\n", nColors, distance);
+}
+
+/** \brief Order the elements for the LUSGS sweeps
+ *
+ * The elements are grouped into waves, the elements of one wave do not
+ * depend on each other and can be processed in parallel:
+ * - serial: every element is its own wave, the original order is kept
+ * - level scheduling: the wave of an element is one more than the highest
+ *	wave of its neighbors with a lower ID, the result is identical to the
+ *	serial sweep
+ * - multicolor: the waves are the colors of a distance-one coloring, this
+ *	changes the order of the sweep and thus the preconditioner, but
+ *	requires far fewer waves
+ */
+void createSweepOrder(void)
+{
+	sweepRank = malloc(nElems * sizeof(long));
+	long *wave = malloc(nElems * sizeof(long));
+	if (!sweepRank || !wave) {
+		printf("| ERROR: could not allocate LUSGS sweep arrays\n");
+		exit(1);
+	}
+
+	switch (sweepType) {
+	case SWEEP_SERIAL:
+		nWaves = nElems;
+		for (long iElem = 0; iElem < nElems; ++iElem) {
+			wave[iElem] = iElem;
+			sweepRank[iElem] = iElem;
+		}
+		printf("| LUSGS Sweep: serial\n");
+		break;
+	case SWEEP_LEVEL:
+		nWaves = 0;
+		for (long iElem = 0; iElem < nElems; ++iElem) {
+			wave[iElem] = 0;
+			for (long k = jacRowStart[iElem]; k < jacDiag[iElem]; ++k) {
+				long level = wave[jacCol[k]] + 1;
+				wave[iElem] = (level > wave[iElem] ? level : wave[iElem]);
+			}
+			nWaves = (wave[iElem] + 1 > nWaves ? wave[iElem] + 1 : nWaves);
+			sweepRank[iElem] = iElem;
+		}
+		printf("| LUSGS Sweep: level scheduling, %ld Levels\n", nWaves);
+		break;
+	case SWEEP_COLOR:
+		nWaves = colorElems(1, wave);
+		for (long iElem = 0; iElem < nElems; ++iElem) {
+			sweepRank[iElem] = wave[iElem];
+		}
+		printf("| LUSGS Sweep: multicolor, %ld Colors\n", nWaves);
+		break;
+	default:
+		printf("| ERROR: LUSGS sweep type unknown\n");
+		exit(1);
+	}
+
+	groupElems(wave, nWaves, &waveStart, &waveElem);
+
+	free(wave);
+}
+
 /**
  * \brief Initialize linear solver
  */
@@ -83,6 +377,7 @@ void initLinearSolver(void)
 
 		nNewtonIterGlobal = 0;
 		nGMRESiterGlobal = 0;
+		nGMRESfailGlobal = 0;
 		nInnerNewton = 0;
 		nInnerGMRES = 0;
 
@@ -93,10 +388,33 @@ void initLinearSolver(void)
 
 		usePrecond = getBool("precond", "F");
 		if (usePrecond) {
-			D = dyn3DdblArray(nElems, NVAR, NVAR);
 			Dinv = dyn3DdblArray(nElems, NVAR, NVAR);
 			deltaXstar = dyn2DdblArray(NVAR, nElems);
-			dRdU = dyn2DdblArray(NVAR * nElems, NVAR * nElems);
+			createJacobianPattern();
+			createColoring();
+
+			sweepType = getInt("LUSGSsweep", "2");
+			createSweepOrder();
+
+			analyticJacobian = getBool("analyticJacobian", "F");
+			if (analyticJacobian) {
+				initFluxJacobian();
+				printf("| Preconditioner Jacobian: analytic\n");
+			} else {
+				printf("| Preconditioner Jacobian: finite differences\n");
+			}
+		}
+
+		exactMatrixVector = getBool("exactMatrixVector", "F");
+		if (exactMatrixVector) {
+			if (!fvTimeDerivativeDual) {
+				printf("| ERROR: exact matrix vector products are not available for the Godunov flux\n");
+				exit(1);
+			}
+			initDualNumbers();
+			printf("| Jacobian-Vector Products: dual numbers\n");
+		} else {
+			printf("| Jacobian-Vector Products: finite differences\n");
 		}
 
 		V = dyn3DdblArray(nKdim, NVAR, nElems);
@@ -178,85 +496,156 @@ bool calcDinv(double **A, double **Ainv)
 	return true;
 }
 
-/**
- * \brief Compute the global Jacobian matrix by use of finite differences
+/** \brief Compute the Jacobian dR / dU by use of finite differences
+ *
+ * All elements of one color are perturbed at the same time, so that the
+ * Jacobian is obtained with `NVAR * nColors` evaluations of the spatial
+ * operator, instead of `NVAR * nElems`. The distance of the coloring
+ * ensures that every block of the nearest neighbor pattern is exact, the
+ * blocks of the wider second order stencil are not stored.
+ *
  * \param[in] time Computation time at calculation
- * \param[in] dt Time step at calculation
  */
-void buildMatrix(double time, double dt)
+void jacobianFD(double time)
 {
-	#pragma omp parallel for
-	for (long iElem = 0; iElem < NVAR * nElems; ++iElem) {
-		for (long jElem = 0; jElem < NVAR * nElems; ++jElem) {
-			dRdU[iElem][jElem] = 0.0;
-		}
-	}
-
-	for (long iElem = 0; iElem < nElems; ++iElem) {
-		elem_t *aElem = elem[iElem];
-
+	for (int iColor = 0; iColor < nColors; ++iColor) {
 		for (int iVar = 0; iVar < NVAR; ++iVar) {
-			aElem->pVar[iVar] += rEps0;
+			#pragma omp parallel for
+			for (long i = colorStart[iColor]; i < colorStart[iColor + 1]; ++i) {
+				elem[colorElem[i]]->pVar[iVar] += rEps0;
+			}
+
 			fvTimeDerivative(time);
-			aElem->pVar[iVar] -= rEps0;
 
-			for (int jVar = 0; jVar < NVAR; ++jVar) {
-				dRdU[iElem * NVAR + jVar][iVar + iElem * NVAR]
-					+= (aElem->u_t[jVar] - R_XK[jVar][iElem]) * srEps0;
-			}
+			#pragma omp parallel for
+			for (long i = colorStart[iColor]; i < colorStart[iColor + 1]; ++i) {
+				long iElem = colorElem[i];
+				elem[iElem]->pVar[iVar] -= rEps0;
 
-			side_t *aSide = aElem->firstSide;
-			while (aSide) {
-				if ((aSide->connection->elem->id >=0)
-						&& (aSide->connection->elem->id) < nElems) {
-					long jElem = aSide->connection->elem->id;
+				/* column iElem of every row that depends on element iElem */
+				for (long k = jacRowStart[iElem]; k < jacRowStart[iElem + 1]; ++k) {
+					long jElem = jacCol[k];
 					elem_t *bElem = elem[jElem];
+					double **block = jacBlock[jacobianBlock(jElem, iElem)];
 
 					for (int jVar = 0; jVar < NVAR; ++jVar) {
-						dRdU[jElem * NVAR + jVar][iVar + iElem * NVAR]
-							+= (bElem->u_t[jVar] - R_XK[jVar][jElem]) * srEps0;
+						block[jVar][iVar] = (bElem->u_t[jVar]
+							- R_XK[jVar][jElem]) * srEps0;
 					}
 				}
+			}
+		}
+	}
+}
 
-				aSide = aSide->nextElemSide;
+/**
+ * \brief Add the flux Jacobians of a face to the rows of its elements
+ *
+ * The residual of an element is the negative sum of the integrated fluxes
+ * over its sides, divided by its area. Ghost elements are not part of the
+ * system and are skipped.
+ *
+ * \param[in] aSide A pointer to the side of the face listed in `side`
+ * \param[in] dFdUL Jacobian of the integrated flux with respect to the state
+ *	of the element of `aSide`
+ * \param[in] dFdUR Jacobian of the integrated flux with respect to the state
+ *	of the element of the connection of `aSide`
+ */
+void addFaceJacobian(side_t *aSide, double dFdUL[NVAR][NVAR],
+		double dFdUR[NVAR][NVAR])
+{
+	long iElemL = aSide->elem - elemBlock;
+	long iElemR = aSide->connection->elem - elemBlock;
+
+	if (iElemL < nElems) {
+		double fac = - elemBlock[iElemL].areaq;
+		double **D = jacBlock[jacDiag[iElemL]];
+		double **N = (iElemR < nElems ?
+				jacBlock[jacobianBlock(iElemL, iElemR)] : NULL);
+		for (int iVar = 0; iVar < NVAR; ++iVar) {
+			for (int jVar = 0; jVar < NVAR; ++jVar) {
+				D[iVar][jVar] += fac * dFdUL[iVar][jVar];
+				if (N) {
+					N[iVar][jVar] += fac * dFdUR[iVar][jVar];
+				}
 			}
 		}
 	}
 
+	if (iElemR < nElems) {
+		double fac = elemBlock[iElemR].areaq;
+		double **D = jacBlock[jacDiag[iElemR]];
+		double **N = (iElemL < nElems ?
+				jacBlock[jacobianBlock(iElemR, iElemL)] : NULL);
+		for (int iVar = 0; iVar < NVAR; ++iVar) {
+			for (int jVar = 0; jVar < NVAR; ++jVar) {
+				D[iVar][jVar] += fac * dFdUR[iVar][jVar];
+				if (N) {
+					N[iVar][jVar] += fac * dFdUL[iVar][jVar];
+				}
+			}
+		}
+	}
+}
+
+/** \brief Compute the preconditioner matrix I - dt * dR / dU
+ *
+ * The Jacobian dR / dU is either assembled from the analytic flux Jacobians
+ * in one sweep over the faces, or approximated by finite differences of the
+ * spatial operator. The time step of each element scales its row of the
+ * matrix.
+ *
+ * \param[in] time Computation time at calculation
+ */
+void buildMatrix(double time)
+{
 	#pragma omp parallel for
-	for (long iElem = 0; iElem < NVAR * nElems; ++iElem) {
-		for (long jElem = 0; jElem < NVAR * nElems; ++jElem) {
-			dRdU[iElem][jElem] *= - dt;
+	for (long iBlock = 0; iBlock < nJacBlocks; ++iBlock) {
+		for (int iVar = 0; iVar < NVAR; ++iVar) {
+			for (int jVar = 0; jVar < NVAR; ++jVar) {
+				jacBlock[iBlock][iVar][jVar] = 0.0;
+			}
 		}
+	}
 
-		dRdU[iElem][iElem] += 1.0;
+	if (analyticJacobian) {
+		fluxJacobianCalculation(time, addFaceJacobian);
+	} else {
+		jacobianFD(time);
 	}
 
 	#pragma omp parallel for
 	for (long iElem = 0; iElem < nElems; ++iElem) {
-		long r = iElem * NVAR;
+		double dt = elemData.dt[iElem];
+		for (long k = jacRowStart[iElem]; k < jacRowStart[iElem + 1]; ++k) {
+			for (int iVar = 0; iVar < NVAR; ++iVar) {
+				for (int jVar = 0; jVar < NVAR; ++jVar) {
+					jacBlock[k][iVar][jVar] *= - dt;
+				}
+			}
+		}
 
+		double **D = jacBlock[jacDiag[iElem]];
 		for (int iVar = 0; iVar < NVAR; ++iVar) {
-			for (int jVar = 0; jVar < NVAR; ++jVar) {
-				D[iElem][iVar][jVar] = dRdU[r + iVar][r + jVar];
-			}
+			D[iVar][iVar] += 1.0;
 		}
 
-		bool isOK = calcDinv(D[iElem], Dinv[iElem]);
+		bool isOK = calcDinv(D, Dinv[iElem]);
 		if (!isOK) {
 			printf("| LUSGS D-Matrix is singular at Element %ld\n", iElem);
 			exit(1);
 		}
-
 	}
 }
 
 /**
  * \brief LUSGS preconditioner
+ *
+ * The sweeps are done wave by wave, all elements of a wave are independent
+ * of each other and are processed in parallel, see createSweepOrder.
+ *
  * \param[in] B Old vector, to be preconditioned
  * \param[out] delX Preconditioned vector
- * \note This function is slow to execute, it might be possible to speed it up
- *	via the use of omp locks for every element
  */
 void LUSGS(double **B, double **delX)
 {
@@ -269,78 +658,78 @@ void LUSGS(double **B, double **delX)
 	}
 
 	/* forward sweep */
-	for (long iElem = 0; iElem < nElems; ++iElem) {
-		elem_t *aElem = elem[iElem];
-		side_t *aSide = aElem->firstSide;
-
-		double tmp1[NVAR] = {0.0};
-		while (aSide) {
-			long NBelemID = aSide->connection->elem->id;
-			if ((NBelemID >= 0) && (NBelemID < iElem)) {
-				long r = iElem * NVAR;
-				long s = NBelemID * NVAR;
+	for (long iWave = 0; iWave < nWaves; ++iWave) {
+		#pragma omp parallel for if (sweepType != SWEEP_SERIAL)
+		for (long i = waveStart[iWave]; i < waveStart[iWave + 1]; ++i) {
+			long iElem = waveElem[i];
+
+			double tmp1[NVAR] = {0.0};
+			for (long k = jacRowStart[iElem]; k < jacRowStart[iElem + 1]; ++k) {
+				long NBelemID = jacCol[k];
+				if (sweepRank[NBelemID] >= sweepRank[iElem]) {
+					continue;
+				}
+
 				for (int iVar = 0; iVar < NVAR; ++iVar) {
 					for (int jVar = 0; jVar < NVAR; ++jVar) {
-						tmp1[iVar] += dRdU[r + iVar][s + jVar]
+						tmp1[iVar] += jacBlock[k][iVar][jVar]
 							* deltaXstar[jVar][NBelemID];
 					}
 				}
 			}
 
-			aSide = aSide->nextElemSide;
-		}
-
-		double tmp2[NVAR] = {0.0};
-		for (int iVar = 0; iVar < NVAR; ++iVar) {
-			for (int jVar = 0; jVar < NVAR; ++jVar) {
-				tmp2[iVar] += Dinv[iElem][iVar][jVar]
-					* (B[jVar][iElem] - tmp1[jVar]);
+			double tmp2[NVAR] = {0.0};
+			for (int iVar = 0; iVar < NVAR; ++iVar) {
+				for (int jVar = 0; jVar < NVAR; ++jVar) {
+					tmp2[iVar] += Dinv[iElem][iVar][jVar]
+						* (B[jVar][iElem] - tmp1[jVar]);
+				}
+				deltaXstar[iVar][iElem] = tmp2[iVar];
 			}
-			deltaXstar[iVar][iElem] = tmp2[iVar];
 		}
 	}
 
 	/* backwards sweep */
-	for (long iElem = nElems - 1; iElem >= 0; --iElem) {
-		elem_t *aElem = elem[iElem];
-		side_t *aSide = aElem->firstSide;
-
-		double tmp1[NVAR] = {0.0};
-		while (aSide) {
-			long NBelemID = aSide->connection->elem->id;
-			if ((NBelemID > iElem) && (NBelemID < nElems)) {
-				long r = iElem * NVAR;
-				long s = NBelemID * NVAR;
+	for (long iWave = nWaves - 1; iWave >= 0; --iWave) {
+		#pragma omp parallel for if (sweepType != SWEEP_SERIAL)
+		for (long i = waveStart[iWave]; i < waveStart[iWave + 1]; ++i) {
+			long iElem = waveElem[i];
+
+			double tmp1[NVAR] = {0.0};
+			for (long k = jacRowStart[iElem]; k < jacRowStart[iElem + 1]; ++k) {
+				long NBelemID = jacCol[k];
+				if (sweepRank[NBelemID] <= sweepRank[iElem]) {
+					continue;
+				}
+
 				for (int iVar = 0; iVar < NVAR; ++iVar) {
 					for (int jVar = 0; jVar < NVAR; ++jVar) {
-						tmp1[iVar] += dRdU[r + iVar][s + jVar]
+						tmp1[iVar] += jacBlock[k][iVar][jVar]
 							* delX[jVar][NBelemID];
 					}
 				}
 			}
 
-			aSide = aSide->nextElemSide;
-		}
-
-		double tmp2[NVAR] = {0.0};
-		for (int iVar = 0; iVar < NVAR; ++iVar) {
-			for (int jVar = 0; jVar < NVAR; ++jVar) {
-				tmp2[iVar] += Dinv[iElem][iVar][jVar]* tmp1[jVar];
+			double tmp2[NVAR] = {0.0};
+			for (int iVar = 0; iVar < NVAR; ++iVar) {
+				for (int jVar = 0; jVar < NVAR; ++jVar) {
+					tmp2[iVar] += Dinv[iElem][iVar][jVar]* tmp1[jVar];
+				}
+				delX[iVar][iElem] = deltaXstar[iVar][iElem] - tmp2[iVar];
 			}
-			delX[iVar][iElem] = deltaXstar[iVar][iElem] - tmp2[iVar];
 		}
 	}
 }
 
 /**
- * \brief Computes matrix vector product using spatial operator and finite differences
+ * \brief Computes matrix vector product using spatial operator and finite
+ *	differences, with the time step of each element
  * \param[in] time Computation time at calculation
- * \param[in] dt Time step at calculation
  * \param[in] alpha Relaxation parameter
  * \param[in] v Input vector for the matrix vector product
  * \param[out] res Resulting vector of the matrix vector product
  */
-void matrixVector(double time, double dt, double alpha, double **v,
+void matrixVectorFD(double time, double alpha, double **v,
 		double **res)
 {
 	/* prerequisites for FD matrix vector approximation */
@@ -365,24 +754,92 @@ void matrixVector(double time, double dt, double alpha, double **v,
 	for (long iElem = 0; iElem < nElems; ++iElem) {
 		elem_t *aElem = elem[iElem];
 
-		res[RHO][iElem] = v[RHO][iElem] - alpha * dt * (aElem->u_t[RHO] - R_XK[RHO][iElem]) / epsFD;
-		res[MX][iElem]  = v[MX][iElem]  - alpha * dt * (aElem->u_t[MX]  - R_XK[MX][iElem])  / epsFD;
-		res[MY][iElem]  = v[MY][iElem]  - alpha * dt * (aElem->u_t[MY]  - R_XK[MY][iElem])  / epsFD;
-		res[E][iElem]   = v[E][iElem]   - alpha * dt * (aElem->u_t[E]   - R_XK[E][iElem])   / epsFD;
+		res[RHO][iElem] = v[RHO][iElem] - alpha * elemData.dt[iElem] * (aElem->u_t[RHO] - R_XK[RHO][iElem]) / epsFD;
+		res[MX][iElem]  = v[MX][iElem]  - alpha * elemData.dt[iElem] * (aElem->u_t[MX]  - R_XK[MX][iElem])  / epsFD;
+		res[MY][iElem]  = v[MY][iElem]  - alpha * elemData.dt[iElem] * (aElem->u_t[MY]  - R_XK[MY][iElem])  / epsFD;
+		res[E][iElem]   = v[E][iElem]   - alpha * elemData.dt[iElem] * (aElem->u_t[E]   - R_XK[E][iElem])   / epsFD;
+	}
+}
+
+/**
+ * \brief Computes the exact matrix vector product, evaluating the spatial
+ *	operator with dual numbers, with the time step of each element
+ *
+ * The state is seeded with the direction `v`, scaled by `DUAL_STEP / |v|`, and
+ * the derivative of the time derivative in that direction is read from the
+ * imaginary part. No difference of two residuals is taken, so there is no
+ * cancellation error.
+ *
+ * \param[in] time Computation time at calculation
+ * \param[in] alpha Relaxation parameter
+ * \param[in] v Input vector for the matrix vector product
+ * \param[out] res Resulting vector of the matrix vector product
+ */
+void matrixVectorDual(double time, double alpha, double **v,
+		double **res)
+{
+	double h = vectorDotProduct(v, v);
+	h = DUAL_STEP / sqrt(h);
+
+	#pragma omp parallel for
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		dual_t cVar[NVAR];
+		cVar[RHO] = XK[RHO][iElem] + I * h * v[RHO][iElem];
+		cVar[MX]  = XK[MX][iElem]  + I * h * v[MX][iElem];
+		cVar[MY]  = XK[MY][iElem]  + I * h * v[MY][iElem];
+		cVar[E]   = XK[E][iElem]   + I * h * v[E][iElem];
+
+		consPrimDual(cVar, dualData.pVar[iElem]);
+	}
+
+	fvTimeDerivativeDual(time);
+
+	#pragma omp parallel for
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		dual_t *u_t = dualData.u_t[iElem];
+
+		res[RHO][iElem] = v[RHO][iElem] - alpha * elemData.dt[iElem] * cimag(u_t[RHO]) / h;
+		res[MX][iElem]  = v[MX][iElem]  - alpha * elemData.dt[iElem] * cimag(u_t[MX])  / h;
+		res[MY][iElem]  = v[MY][iElem]  - alpha * elemData.dt[iElem] * cimag(u_t[MY])  / h;
+		res[E][iElem]   = v[E][iElem]   - alpha * elemData.dt[iElem] * cimag(u_t[E])   / h;
+	}
+}
+
+/**
+ * \brief Computes the matrix vector product, either with dual numbers or by
+ *	finite differences
+ * \param[in] time Computation time at calculation
+ * \param[in] alpha Relaxation parameter
+ * \param[in] v Input vector for the matrix vector product
+ * \param[out] res Resulting vector of the matrix vector product
+ */
+void matrixVector(double time, double alpha, double **v,
+		double **res)
+{
+	if (exactMatrixVector) {
+		matrixVectorDual(time, alpha, v, res);
+	} else {
+		matrixVectorFD(time, alpha, v, res);
 	}
 }
 
 /**
  * \brief Uses matrix free to solve the linear system
+ *
+ * If the abort criterion is not reached with `nKdim` Krylov vectors, the
+ * best approximation in the Krylov space is returned, which is the usual
+ * inexact Newton update. The update is only unusable if it does not reduce
+ * the residual of the linear system at all.
+ *
  * \param[in] time Computation time at calculation
- * \param[in] dt Time step at calculation
  * \param[in] alpha Relaxation parameter
  * \param[in] B Right hand side
  * \param[in] normB Norm of right hand side
  * \param[in,out] abortCrit GMRES abort criterium
  * \param[out] delX Resulting x vector of the linear system
+ * \return False if the update does not reduce the linear residual
  */
-void GMRES_M(double time, double dt, double alpha, double **B,
+bool GMRES_M(double time, double alpha, double **B,
 		double normB, double *abortCrit, double **delX)
 {
 	*abortCrit = epsGMRES * normB;
@@ -416,7 +873,7 @@ void GMRES_M(double time, double dt, double alpha, double **B,
 	double H[nKdim + 1][nKdim + 1], C[nKdim], S[nKdim];
 
 	if (usePrecond) {
-		buildMatrix(t, dt);
+		buildMatrix(t);
 	}
 
 	for (m = 0; m < nKdim; ++m) {
@@ -434,7 +891,7 @@ void GMRES_M(double time, double dt, double alpha, double **B,
 			}
 		}
 
-		matrixVector(time, dt, alpha, Z[m], W);
+		matrixVector(time, alpha, Z[m], W);
 
 		/* Gram-Schmidt */
 		for (int nn = 0; nn <= m; ++nn) {
@@ -490,7 +947,11 @@ void GMRES_M(double time, double dt, double alpha, double **B,
 			}
 			nGMRESiterGlobal += nInnerGMRES;
 
-			return;
+			if (!(fabs(gam[m + 1]) < normR0)) {
+				nGMRESfailGlobal++;
+				return false;
+			}
+			return true;
 		} else {
 			/* no convergence, next iteration */
 			#pragma omp parallel for
@@ -503,10 +964,8 @@ void GMRES_M(double time, double dt, double alpha, double **B,
 		}
 	}
 
-	printf("| GMRES not converged with %d iterations:\n", nInnerGMRES);
-	printf("| Norm_R0: %g\n", fabs(gam[0]));
-	printf("| Norm_R : %g\n", fabs(gam[m]));
-	exit(1);
+	nGMRESfailGlobal++;
+	return false;
 }
 
 /**
@@ -524,9 +983,20 @@ void freeLinearSolver(void)
 
 		if (usePrecond) {
 			free(deltaXstar);
-			free(D);
 			free(Dinv);
-			free(dRdU);
+			free(jacRowStart);
+			free(jacCol);
+			free(jacDiag);
+			free(jacBlock);
+			free(colorStart);
+			free(colorElem);
+			free(waveStart);
+			free(waveElem);
+			free(sweepRank);
+		}
+
+		if (exactMatrixVector) {
+			freeDualNumbers();
 		}
 	}
 }
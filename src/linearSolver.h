@@ -17,6 +17,7 @@ extern int nNewtonIter;
 extern int nNewtonIterGlobal;
 
 extern int nGMRESiterGlobal;
+extern int nGMRESfailGlobal;
 
 extern int nInnerNewton;
 
@@ -38,7 +39,7 @@ extern double **R_XK;
 
 void initLinearSolver(void);
 double vectorDotProduct(double **A, double **B);
-void GMRES_M(double time, double dt, double alpha, double **B,
+bool GMRES_M(double time, double alpha, double **B,
 		double normB, double *abortCrit, double **deltaX);
 void freeLinearSolver(void);
 
@@ -20,6 +20,7 @@
 #include "initialCondition.h"
 #include "finiteVolume.h"
 #include "linearSolver.h"
+#include "multigrid.h"
 #include "analyze.h"
 
 /** \brief Main function
@@ -106,6 +107,7 @@ int main(int argc, char *argv[])
 	initFV();
 	initTimeDisc();
 	initLinearSolver();
+	initMultigrid();
 	outputTimes = NULL;
 
 	/* setting initial condition */
@@ -122,9 +124,11 @@ int main(int argc, char *argv[])
 
 	/* clean that memory, like you should */
 	freeMesh();
+	freeFV();
 	freeBoundary();
 	freeOutputTimes();
 	freeInitialCondition();
 	freeAnalyze();
 	freeLinearSolver();
+	freeMultigrid();
 }
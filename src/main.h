@@ -70,6 +70,15 @@ enum meshType {
 	CARTESIAN		/**< cartesian */
 };
 
+/**
+ * \brief Renumbering of the mesh elements
+ */
+enum meshRenumbering {
+	RENUMBER_NONE,		/**< keep the order of the mesh file */
+	RENUMBER_RCM,		/**< reverse Cuthill-McKee ordering */
+	RENUMBER_HILBERT	/**< Hilbert curve of the barycenters */
+};
+
 /**
  * \brief Aliases for the different flux functions
  */
@@ -92,7 +101,17 @@ enum fluxFunction {
  */
 enum limiterFunction {
 	BARTHJESPERSEN = 1,	/**< Barth & Jespersen limiter */
-	VENKATAKRISHNAN		/**< Venkatakrishnan limiter */
+	VENKATAKRISHNAN,	/**< Venkatakrishnan limiter */
+	FROZEN_LIMITER		/**< frozen limiter values, see freezeLimiter */
+};
+
+/**
+ * \brief Ordering of the LUSGS sweeps
+ */
+enum lusgsSweep {
+	SWEEP_SERIAL = 1,	/**< serial sweep in element order */
+	SWEEP_LEVEL,		/**< parallel sweep by dependency levels */
+	SWEEP_COLOR		/**< parallel sweep by element colors */
 };
 
 /**
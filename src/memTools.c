@@ -20,6 +20,9 @@
 #include <string.h>
 
 #include "cgnslib.h"
+#include "memTools.h"
+
+#define ARENA_ALIGN 16			/**< alignment of arena allocations */
 
 /** \brief Allocate a dynamic 2D array of integers
  * \param[in] I Number of elements in the first dimension
@@ -180,3 +183,83 @@ char **dynStringArray(long I, long J)
 	}
 	return arr;
 }
+
+/** \brief Initialize an empty arena
+ * \param[out] arena Pointer to the arena
+ * \param[in] blockSize Size of the memory blocks in bytes, ideally large
+ *	enough for all objects
+ */
+void arenaInit(arena_t *arena, size_t blockSize)
+{
+	arena->block = NULL;
+	arena->blockSize = blockSize;
+}
+
+/** \brief Allocate zero initialized memory from an arena
+ *
+ * A new block is allocated whenever the current one is full, larger
+ * requests get a block of their own.
+ *
+ * \param[in,out] arena Pointer to the arena
+ * \param[in] size Size of the object in bytes
+ * \return Pointer to the memory
+ */
+void *arenaAlloc(arena_t *arena, size_t size)
+{
+	size = (size + ARENA_ALIGN - 1) / ARENA_ALIGN * ARENA_ALIGN;
+
+	arenaBlock_t *aBlock = arena->block;
+	if (!aBlock || (aBlock->used + size > aBlock->size)) {
+		aBlock = malloc(sizeof(arenaBlock_t));
+		if (!aBlock) {
+			printf("| ERROR: could not allocate aBlock\n");
+			exit(1);
+		}
+
+		aBlock->size = (size > arena->blockSize ? size : arena->blockSize);
+		aBlock->used = 0;
+		aBlock->mem = calloc(1, aBlock->size);
+		if (!aBlock->mem) {
+			printf("| ERROR: could not allocate aBlock->mem\n");
+			exit(1);
+		}
+
+		aBlock->next = arena->block;
+		arena->block = aBlock;
+	}
+
+	void *ptr = aBlock->mem + aBlock->used;
+	aBlock->used += size;
+	return ptr;
+}
+
+/** \brief Allocate a 2D array of doubles from an arena
+ * \param[in,out] arena Pointer to the arena
+ * \param[in] I Number of elements in the first dimension
+ * \param[in] J Number of elements in the second dimension
+ * \return Pointer to a 2D double array
+ */
+double **arena2DdblArray(arena_t *arena, long I, long J)
+{
+	double **arr = arenaAlloc(arena, sizeof(double *) * I);
+	double *ptr = arenaAlloc(arena, sizeof(double) * I * J);
+	for (long i = 0; i < I; ++i) {
+		arr[i] = ptr + J * i;
+	}
+	return arr;
+}
+
+/** \brief Release all memory of an arena
+ * \param[in,out] arena Pointer to the arena
+ */
+void arenaFree(arena_t *arena)
+{
+	arenaBlock_t *aBlock = arena->block;
+	while (aBlock) {
+		arenaBlock_t *tmp = aBlock;
+		aBlock = aBlock->next;
+		free(tmp->mem);
+		free(tmp);
+	}
+	arena->block = NULL;
+}
@@ -7,8 +7,32 @@
 #ifndef MEMTOOLS_H
 #define MEMTOOLS_H
 
+#include <stddef.h>
+
 #include "cgnslib.h"
 
+typedef struct arenaBlock_t arenaBlock_t;
+typedef struct arena_t arena_t;
+
+/**
+ * \brief Memory block of an arena
+ */
+struct arenaBlock_t {
+	char *mem;			/**< zero initialized memory of the block */
+	size_t size;			/**< size of the block in bytes */
+	size_t used;			/**< number of used bytes */
+	arenaBlock_t *next;		/**< previously filled block */
+};
+
+/**
+ * \brief Arena allocator: objects are placed consecutively into large
+ *	blocks and are released all at once
+ */
+struct arena_t {
+	arenaBlock_t *block;		/**< current block */
+	size_t blockSize;		/**< default size of new blocks */
+};
+
 long **dyn2DintArray(long I, long J);
 cgsize_t **dyn2DcgsizeArray(long I, long J);
 double **dyn2DdblArray(long I, long J);
@@ -17,4 +41,9 @@ double ***dyn3DdblArray(long I, long J, long K);
 double ****dyn4DdblArray(long I, long J, long K, long L);
 char **dynStringArray(long I, long J);
 
+void arenaInit(arena_t *arena, size_t blockSize);
+void *arenaAlloc(arena_t *arena, size_t size);
+double **arena2DdblArray(arena_t *arena, long I, long J);
+void arenaFree(arena_t *arena);
+
 #endif
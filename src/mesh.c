@@ -7,6 +7,8 @@
  */
 
 typedef struct sideList_t sideList_t;
+typedef struct sortKey_t sortKey_t;
+typedef struct periodicKey_t periodicKey_t;
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -21,6 +23,8 @@ typedef struct sideList_t sideList_t;
 #include "output.h"
 #include "timeDiscretization.h"
 #include "memTools.h"
+#include "gmshReader.h"
+#include "meshCache.h"
 #include "initialCondition.h"
 #include "cgnslib.h"
 
@@ -35,6 +39,10 @@ char gridFile[STRLEN];			/**< complete name of the output mesh file */
 
 int meshType;				/**< code for the mesh type */
 int meshFormat;				/**< code for the mesh format */
+int meshRenumbering;			/**< code for the element renumbering */
+bool useMeshCache;			/**< flag for reading and writing the
+					mesh cache */
+char meshCacheFile[STRLEN];		/**< name of the mesh cache file */
 
 long nNodes;				/**< global number of nodes */
 
@@ -53,6 +61,22 @@ double yMin;				/**< maximum y-direction extension */
 double yMax;				/**< minimum y-direction extension */
 double dxRef;				/**< reference x length */
 
+elemData_t elemData;			/**< contiguous element state */
+sideData_t sideData;			/**< contiguous side state */
+
+elem_t *elemBlock;			/**< storage of all elements, the ghost
+					elements follow the inner elements */
+side_t *sideBlock;			/**< storage of all sides */
+arena_t meshArena;			/**< storage of the nodes, the node and
+					Gaussian point arrays of the elements
+					and the BC side list */
+
+long *elemSideStart;			/**< offsets of the sides of every element
+					in `elemSide` and `elemNB` */
+long *elemSide;				/**< side IDs of all elements */
+long *elemNB;				/**< state index of the neighbor element
+					across each side */
+
 elem_t **elem;				/**< global element pointer array */
 side_t **side;				/**< global side pointer array */
 side_t **BCside;			/**< global BC side pointer array */
@@ -73,6 +97,87 @@ struct sideList_t {
 	bool isRotated;			/**< flag for if the side is rotated */
 };
 
+/**
+ * \brief Helper structure for matching periodic sides by the cell of their
+ *	Gaussian point
+ */
+struct periodicKey_t {
+	int nPeriodicBC;		/**< number of the periodic BC pair */
+	long ix;			/**< x-index of the cell */
+	long iy;			/**< y-index of the cell */
+	side_t *side;			/**< pointer to the side */
+};
+
+/**
+ * \brief Helper structure for sorting elements and sides during the
+ *	renumbering of the mesh
+ */
+struct sortKey_t {
+	unsigned long key;		/**< sorting key */
+	void *ptr;			/**< pointer to the sorted object */
+};
+
+/**
+ * \brief Allocate the contiguous element and side state arrays
+ * \param[in] nElemsTotal Number of inner and ghost elements
+ * \param[in] nSidesTotal Number of sides, i.e. twice the number of faces
+ */
+void createStateData(long nElemsTotal, long nSidesTotal)
+{
+	elemData.nElems = nElemsTotal;
+	elemData.pVar = calloc(nElemsTotal, sizeof(double[NVAR]));
+	elemData.cVar = calloc(nElemsTotal, sizeof(double[NVAR]));
+	elemData.cVarStage = calloc(nElemsTotal, sizeof(double[NVAR]));
+	elemData.u_x = calloc(nElemsTotal, sizeof(double[NVAR]));
+	elemData.u_y = calloc(nElemsTotal, sizeof(double[NVAR]));
+	elemData.u_t = calloc(nElemsTotal, sizeof(double[NVAR]));
+	elemData.source = calloc(nElemsTotal, sizeof(double[NVAR]));
+	elemData.dt = calloc(nElemsTotal, sizeof(double));
+	if (!elemData.pVar || !elemData.cVar || !elemData.cVarStage ||
+	    !elemData.u_x || !elemData.u_y || !elemData.u_t ||
+	    !elemData.source || !elemData.dt) {
+		printf("| ERROR: could not allocate elemData\n");
+		exit(1);
+	}
+
+	sideData.nSides = nSidesTotal;
+	sideData.n = calloc(nSidesTotal, sizeof(double[NDIM]));
+	sideData.len = calloc(nSidesTotal, sizeof(double));
+	sideData.GP = calloc(nSidesTotal, sizeof(double[NDIM]));
+	sideData.w = calloc(nSidesTotal, sizeof(double[NDIM]));
+	if (!sideData.n || !sideData.len || !sideData.GP || !sideData.w) {
+		printf("| ERROR: could not allocate sideData\n");
+		exit(1);
+	}
+}
+
+/**
+ * \brief Point the state of an element into the contiguous arrays
+ * \param[in,out] aElem A pointer to an element
+ * \param[in] iData Index of the element in `elemData`
+ */
+void linkElemData(elem_t *aElem, long iData)
+{
+	aElem->pVar = elemData.pVar[iData];
+	aElem->cVar = elemData.cVar[iData];
+	aElem->cVarStage = elemData.cVarStage[iData];
+	aElem->u_x = elemData.u_x[iData];
+	aElem->u_y = elemData.u_y[iData];
+	aElem->u_t = elemData.u_t[iData];
+	aElem->source = elemData.source[iData];
+}
+
+/**
+ * \brief Point the state of a side into the contiguous arrays, using its ID
+ * \param[in,out] aSide A pointer to a side
+ */
+void linkSideData(side_t *aSide)
+{
+	aSide->n = sideData.n[aSide->id];
+	aSide->GP = sideData.GP[aSide->id];
+	aSide->w = sideData.w[aSide->id];
+}
+
 /**
  * \brief Compute required vectors for reconstruction
  * \param[in] aElem A pointer to an element
@@ -117,13 +222,8 @@ void createReconstructionInfo(elem_t *aElem)
 	switch (aElem->elemType) {
 	case 3:
 		aElem->nGP = 3;
-		aElem->wGP = malloc(aElem->nGP * sizeof(double));
-		if (!aElem->wGP) {
-			printf("| ERROR: could not allocate aElem->wGP\n");
-			exit(1);
-		}
-
-		aElem->xGP = dyn2DdblArray(aElem->nGP, NDIM);
+		aElem->wGP = arenaAlloc(&meshArena, aElem->nGP * sizeof(double));
+		aElem->xGP = arena2DdblArray(&meshArena, aElem->nGP, NDIM);
 
 		aSide = aElem->firstSide;
 		for (int iGP = 0; iGP < aElem->nGP; ++iGP) {
@@ -137,13 +237,8 @@ void createReconstructionInfo(elem_t *aElem)
 		break;
 	case 4:
 		aElem->nGP = 5;
-		aElem->wGP = malloc(aElem->nGP * sizeof(double));
-		if (!aElem->wGP) {
-			printf("| ERROR: could not allocate aElem->wGP\n");
-			exit(1);
-		}
-
-		aElem->xGP = dyn2DdblArray(aElem->nGP, NDIM);
+		aElem->wGP = arenaAlloc(&meshArena, aElem->nGP * sizeof(double));
+		aElem->xGP = arena2DdblArray(&meshArena, aElem->nGP, NDIM);
 
 		aSide = aElem->firstSide;
 		for (int iGP = 0; iGP < aElem->nGP - 1; ++iGP) {
@@ -166,81 +261,163 @@ void createReconstructionInfo(elem_t *aElem)
 	}
 }
 
+/**
+ * \brief Compare two periodic side keys, first by the periodic BC pair, then
+ *	by the cell of the Gaussian point
+ * \param[in] a Pointer to the first key
+ * \param[in] b Pointer to the second key
+ * \return Comparison result for qsort and bsearch
+ */
+int comparePeriodicKey(const void *a, const void *b)
+{
+	const periodicKey_t *keyA = a;
+	const periodicKey_t *keyB = b;
+
+	if (keyA->nPeriodicBC != keyB->nPeriodicBC) {
+		return (keyA->nPeriodicBC > keyB->nPeriodicBC) - (keyA->nPeriodicBC < keyB->nPeriodicBC);
+	}
+	if (keyA->ix != keyB->ix) {
+		return (keyA->ix > keyB->ix) - (keyA->ix < keyB->ix);
+	}
+	return (keyA->iy > keyB->iy) - (keyA->iy < keyB->iy);
+}
+
 /**
  * \brief Create connection for periodic BCs
+ *
+ * The Gaussian points of all target sides (BCid ending in 2) are sorted by
+ * their cell on a grid, which is coarser than the matching tolerance. The
+ * translated Gaussian point of every source side (BCid ending in 1) is then
+ * looked up in its own and the neighboring cells. The target sides are
+ * removed from the side list in a single pass afterwards.
  */
 void connectPeriodicBC(void)
 {
+	const double tol = 1e-7;		/* matching tolerance */
+	const double h = 10.0 * tol;		/* cell size of the search grid */
+
 	isPeriodic = false;
 
+	/* sorted keys of the target sides */
+	long nTargets = 0;
 	sidePtr_t *aBCside = firstBCside;
+	while (aBCside) {
+		side_t *sSide = aBCside->side;
+		if ((sSide->BC->BCtype == PERIODIC) &&
+		    ((sSide->BC->BCid % 10) == 2)) {
+			nTargets++;
+		}
+		aBCside = aBCside->next;
+	}
+
+	if (nTargets == 0) {
+		return;
+	}
+
+	periodicKey_t *keys = malloc(nTargets * sizeof(periodicKey_t));
+	bool *isRemoved = calloc(2 * nSides, sizeof(bool));
+	if (!keys || !isRemoved) {
+		printf("| ERROR: could not allocate periodic keys\n");
+		exit(1);
+	}
+
+	long iTarget = 0;
+	aBCside = firstBCside;
+	while (aBCside) {
+		side_t *sSide = aBCside->side;
+		if ((sSide->BC->BCtype == PERIODIC) &&
+		    ((sSide->BC->BCid % 10) == 2)) {
+			keys[iTarget].nPeriodicBC = sSide->BC->BCid / 10;
+			keys[iTarget].ix = floor((sSide->GP[X] + sSide->elem->bary[X]) / h);
+			keys[iTarget].iy = floor((sSide->GP[Y] + sSide->elem->bary[Y]) / h);
+			keys[iTarget].side = sSide;
+			iTarget++;
+		}
+		aBCside = aBCside->next;
+	}
+	qsort(keys, nTargets, sizeof(periodicKey_t), comparePeriodicKey);
+
+	/* connect every source side to its target side */
 	double aGPpos[2], sGPpos[2];
-	bool isConnected;
+	aBCside = firstBCside;
 	while (aBCside) {
 		side_t *aSide = aBCside->side;
 		if ((aSide->BC->BCtype == PERIODIC) &&
 		    ((aSide->BC->BCid % 10) == 1)) {
 			isPeriodic = true;
-			isConnected = false;
 
 			aGPpos[X] = aSide->GP[X] + aSide->elem->bary[X];
 			aGPpos[Y] = aSide->GP[Y] + aSide->elem->bary[Y];
 
-			int nPeriodicBC = aSide->BC->BCid / 10;
-
-			sidePtr_t *sBCside = firstBCside;
-			while (sBCside) {
-				side_t *sSide = sBCside->side;
+			periodicKey_t key;
+			key.nPeriodicBC = aSide->BC->BCid / 10;
+			long ix = floor((aGPpos[X] + aSide->BC->connection[X]) / h);
+			long iy = floor((aGPpos[Y] + aSide->BC->connection[Y]) / h);
+
+			side_t *sSide = NULL;
+			for (key.ix = ix - 1; (key.ix <= ix + 1) && !sSide; ++key.ix) {
+				for (key.iy = iy - 1; (key.iy <= iy + 1) && !sSide; ++key.iy) {
+					periodicKey_t *match = bsearch(&key, keys,
+							nTargets, sizeof(periodicKey_t),
+							comparePeriodicKey);
+					if (!match) {
+						continue;
+					}
 
-				/* check for potential connection */
-				if ((sSide->BC->BCtype == PERIODIC) &&
-				    ((sSide->BC->BCid % 10) == 2) &&
-				    ((sSide->BC->BCid / 10) == nPeriodicBC)) {
+					/* first key of the cell */
+					while ((match > keys) &&
+					       (comparePeriodicKey(match - 1, &key) == 0)) {
+						match--;
+					}
 
 					/* check if the connection works out */
-					sGPpos[X] = sSide->GP[X] + sSide->elem->bary[X];
-					sGPpos[Y] = sSide->GP[Y] + sSide->elem->bary[Y];
-
-					if ((fabs(aGPpos[X] + aSide->BC->connection[X] - sGPpos[X]) +
-					     fabs(aGPpos[Y] + aSide->BC->connection[Y] - sGPpos[Y])) <= 1e-7) {
-
-						isConnected = true;
-
-						side_t *urSide = aSide->connection;
-						side_t *targetSide = sSide->connection;
-						urSide->connection = targetSide;
-						targetSide->connection = urSide;
-
-						/* reorganise lists: target side has to be removed */
-						nSides--;
-						if (firstSide == targetSide) {
-							firstSide = firstSide->next;
-						} else {
-							side_t *sSide = firstSide;
-							while (sSide) {
-								if (sSide->next == targetSide) {
-									sSide->next = targetSide->next;
-									break;
-								}
-								sSide = sSide->next;
-							}
+					for (; (match < keys + nTargets) &&
+					       (comparePeriodicKey(match, &key) == 0); ++match) {
+						sGPpos[X] = match->side->GP[X] + match->side->elem->bary[X];
+						sGPpos[Y] = match->side->GP[Y] + match->side->elem->bary[Y];
+
+						if ((fabs(aGPpos[X] + aSide->BC->connection[X] - sGPpos[X]) +
+						     fabs(aGPpos[Y] + aSide->BC->connection[Y] - sGPpos[Y])) <= tol) {
+							sSide = match->side;
+							break;
 						}
-						break;
 					}
 				}
-
-				sBCside = sBCside->next;
 			}
 
-			if (!isConnected) {
+			if (!sSide) {
 				printf("| ERROR in connectPeriodicBC: No connection found\n");
 				printf("| Side GP was: %g %g\n", aGPpos[X], aGPpos[Y]);
 				exit(1);
 			}
+
+			side_t *urSide = aSide->connection;
+			side_t *targetSide = sSide->connection;
+			urSide->connection = targetSide;
+			targetSide->connection = urSide;
+
+			/* target side has to be removed from the side list */
+			isRemoved[targetSide->id] = true;
+			nSides--;
 		}
 
 		aBCside = aBCside->next;
 	}
+
+	/* remove all target sides from the side list */
+	while (firstSide && isRemoved[firstSide->id]) {
+		firstSide = firstSide->next;
+	}
+	side_t *aSide = firstSide;
+	while (aSide) {
+		while (aSide->next && isRemoved[aSide->next->id]) {
+			aSide->next = aSide->next->next;
+		}
+		aSide = aSide->next;
+	}
+
+	free(keys);
+	free(isRemoved);
 }
 
 /**
@@ -252,10 +429,11 @@ void createSideInfo(side_t *aSide)
 	aSide->n[X] = aSide->node[1]->x[Y] - aSide->node[0]->x[Y];
 	aSide->n[Y] = aSide->node[0]->x[X] - aSide->node[1]->x[X];
 
-	aSide->len = sqrt(aSide->n[X] * aSide->n[X] + aSide->n[Y] * aSide->n[Y]);
+	double len = sqrt(aSide->n[X] * aSide->n[X] + aSide->n[Y] * aSide->n[Y]);
+	sideData.len[aSide->id] = len;
 
-	aSide->n[X] /= aSide->len;
-	aSide->n[Y] /= aSide->len;
+	aSide->n[X] /= len;
+	aSide->n[Y] /= len;
 
 	double GP[NDIM];
 	GP[X] = 0.5 * (aSide->node[0]->x[X] + aSide->node[1]->x[X]);
@@ -285,7 +463,7 @@ void createSideInfo(side_t *aSide)
 	aSide->connection->GP[Y] = GP[Y] - aSide->connection->elem->bary[Y];
 	aSide->connection->n[X]  = - aSide->n[X];
 	aSide->connection->n[Y]  = - aSide->n[Y];
-	aSide->connection->len   = aSide->len;
+	sideData.len[aSide->connection->id] = len;
 }
 
 /**
@@ -375,620 +553,545 @@ int compare(const void *a, const void *b)
 }
 
 /**
- * \brief Create a cartesian mesh
- * \param[in,out] vertex Pointer to 2D array, used for the vertices
- * \param[in,out] nVertices Pointer to the number of total vertices in `vertex`
- * \param[in,out] BCedge Pointer to 2D array, used for the BC edges
- * \param[in,out] nBCedges Pointer to the number of total BC edges
- * \param[in,out] quad Pointer to a 2D array, used for the quadrangles
+ * \brief Compare two sort keys, used in qsort
+ * \param[in] a Pointer to a sort key
+ * \param[in] b Pointer to a sort key
+ * \return Negative, zero or positive, if the key of a is smaller, equal, or
+ *	larger than that of b
  */
-void createCartMesh(
-	double ***vertex, long *nVertices, long ***BCedge, long *nBCedges, long ***quad)
+int compareSortKey(const void *a, const void *b)
 {
-	/* set up necessary variables */
-	long iMax = cartMesh.iMax;
-	long jMax = cartMesh.jMax;
-
-	*nVertices = (iMax + 1) * (jMax + 1);
-	nQuads = iMax * jMax;
-	*nBCedges = 2 * (iMax + jMax);
-
-	double dx = (xMax - xMin) / iMax;
-	double dy = (yMax - yMin) / jMax;
+	sortKey_t *A = (sortKey_t *)a;
+	sortKey_t *B = (sortKey_t *)b;
+	return (A->key > B->key) - (A->key < B->key);
+}
 
-	*quad = dyn2DintArray(nQuads, 5);
-	*BCedge = dyn2DintArray(*nBCedges, 3);
-	*vertex = dyn2DdblArray(*nVertices, 2);
+/**
+ * \brief Compute the position of a point along a Hilbert curve
+ * \param[in] n Number of grid points in each direction, a power of two
+ * \param[in] x Integer x-coordinate of the point, below `n`
+ * \param[in] y Integer y-coordinate of the point, below `n`
+ * \return Position of the point along the curve
+ */
+unsigned long hilbertIndex(unsigned long n, unsigned long x, unsigned long y)
+{
+	unsigned long d = 0;
+	for (unsigned long s = n / 2; s > 0; s /= 2) {
+		unsigned long rx = ((x & s) > 0);
+		unsigned long ry = ((y & s) > 0);
+		d += s * s * ((3 * rx) ^ ry);
+
+		/* rotate the quadrant */
+		if (ry == 0) {
+			if (rx == 1) {
+				x = n - 1 - x;
+				y = n - 1 - y;
+			}
 
-	/* build vertices */
-	double y = yMin, x;
-	long k = 0;
-	for (long j = 0; j < jMax + 1; ++j) {
-		x = xMin;
-		for (long i = 0; i < iMax + 1; ++i) {
-			(*vertex)[k][X] = x;
-			(*vertex)[k][Y] = y;
-			k++;
-			x += dx;
+			unsigned long tmp = x;
+			x = y;
+			y = tmp;
 		}
-		y += dy;
 	}
 
-	/* build elements */
-	k = 0;
-	for (long j = 0; j < jMax; ++j) {
-		for (long i = 0; i < iMax; ++i) {
-			(*quad)[k][0] = k + j;
-			(*quad)[k][1] = (*quad)[k][0] + 1;
-			(*quad)[k][2] = (*quad)[k][1] + iMax + 1;
-			(*quad)[k][3] = (*quad)[k][2] - 1;
-			(*quad)[k][4] = 1;
-			k++;
-		}
-	}
+	return d;
+}
 
-	/* build BCedges */
-	k = 0;
-	/* bottom side */
-	printf("| Bottom Side:\n");
-	printf("|   # of BCs: %d\n", cartMesh.nBC[BOTTOM]);
-	for (int iBC = 0; iBC < cartMesh.nBC[BOTTOM]; ++iBC) {
-		printf("|   BC Type : %d\n", cartMesh.BCtype[BOTTOM][iBC]);
-		printf("|   BC Range: %d -- %d\n", cartMesh.BCrange[BOTTOM][iBC][0], cartMesh.BCrange[BOTTOM][iBC][1]);
-		for (int i = cartMesh.BCrange[BOTTOM][iBC][0] - 1; i < cartMesh.BCrange[BOTTOM][iBC][1]; ++i) {
-			(*BCedge)[k][0] = i;
-			(*BCedge)[k][1] = i + 1;
-			(*BCedge)[k][2] = cartMesh.BCtype[BOTTOM][iBC];
-			k++;
-		}
-	}
-	/* right side */
-	printf("| Right Side:\n");
-	printf("|   # of BCs: %d\n", cartMesh.nBC[RIGHT]);
-	for (int iBC = 0; iBC < cartMesh.nBC[RIGHT]; ++iBC) {
-		printf("|   BC Type : %d\n", cartMesh.BCtype[RIGHT][iBC]);
-		printf("|   BC Range: %d -- %d\n", cartMesh.BCrange[RIGHT][iBC][0], cartMesh.BCrange[RIGHT][iBC][1]);
-		for (int j = cartMesh.BCrange[RIGHT][iBC][0] - 1; j < cartMesh.BCrange[RIGHT][iBC][1]; ++j) {
-			(*BCedge)[k][0] = (iMax + 1) * (j + 1) - 1;
-			(*BCedge)[k][1] = (iMax + 1) * (j + 2) - 1;
-			(*BCedge)[k][2] = cartMesh.BCtype[RIGHT][iBC];
-			k++;
-		}
+/**
+ * \brief Order the elements along a Hilbert curve through their barycenters
+ * \param[in] elemList Elements in the original order
+ * \param[out] newList Elements in the new order
+ */
+void orderHilbert(elem_t **elemList, elem_t **newList)
+{
+	sortKey_t *keys = malloc(nElems * sizeof(sortKey_t));
+	if (!keys) {
+		printf("| ERROR: could not allocate keys\n");
+		exit(1);
 	}
-	/* top side */
-	printf("| Top Side:\n");
-	printf("|   # of BCs: %d\n", cartMesh.nBC[TOP]);
-	for (int iBC = 0; iBC < cartMesh.nBC[TOP]; ++iBC) {
-		printf("|   BC Type : %d\n", cartMesh.BCtype[TOP][iBC]);
-		printf("|   BC Range: %d -- %d\n", cartMesh.BCrange[TOP][iBC][0], cartMesh.BCrange[TOP][iBC][1]);
-		for (int i = cartMesh.BCrange[TOP][iBC][0] - 1; i < cartMesh.BCrange[TOP][iBC][1]; ++i) {
-			(*BCedge)[k][0] = (iMax + 1) * jMax + i;
-			(*BCedge)[k][1] = (*BCedge)[k][0] + 1;
-			(*BCedge)[k][2] = cartMesh.BCtype[TOP][iBC];
-			k++;
-		}
+
+	unsigned long n = 1UL << 16;
+	double scale = (n - 1) / fmax(fmax(xMax - xMin, yMax - yMin), DBL_MIN);
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		elem_t *aElem = elemList[iElem];
+		unsigned long x = (aElem->bary[X] - xMin) * scale;
+		unsigned long y = (aElem->bary[Y] - yMin) * scale;
+
+		keys[iElem].key = hilbertIndex(n, x, y);
+		keys[iElem].ptr = aElem;
 	}
-	/* left side */
-	printf("| Left Side:\n");
-	printf("|   # of BCs: %d\n", cartMesh.nBC[LEFT]);
-	for (int iBC = 0; iBC < cartMesh.nBC[LEFT]; ++iBC) {
-		printf("|   BC Type : %d\n", cartMesh.BCtype[LEFT][iBC]);
-		printf("|   BC Range: %d -- %d\n", cartMesh.BCrange[LEFT][iBC][0], cartMesh.BCrange[LEFT][iBC][1]);
-		for (int j = cartMesh.BCrange[LEFT][iBC][0] - 1; j < cartMesh.BCrange[LEFT][iBC][1]; ++j) {
-			(*BCedge)[k][0] = j * (iMax + 1);
-			(*BCedge)[k][1] = (*BCedge)[k][0] + iMax + 1;
-			(*BCedge)[k][2] = cartMesh.BCtype[LEFT][iBC];
-			k++;
-		}
+
+	qsort(keys, nElems, sizeof(sortKey_t), compareSortKey);
+
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		newList[iElem] = keys[iElem].ptr;
 	}
 
-	free(cartMesh.nBC);
+	free(keys);
 }
 
 /**
- * \brief Read in a gmsh mesh file
- * \param[in] fileName Name of the mesh file
- * \param[in,out] vertex Pointer to 2D array, used for the vertices
- * \param[in,out] nVertices Pointer to the number of total vertices in `vertex`
- * \param[in,out] BCedge Pointer to 2D array, used for the BC edges
- * \param[in,out] nBCedges Pointer to the number of total BC edges
- * \param[in,out] tria Pointer to a 2D array, used for the triangles
- * \param[in,out] quad Pointer to a 2D array, used for the quadrangles
+ * \brief Order the elements with the reverse Cuthill-McKee algorithm
+ *
+ * Each connected part of the mesh is traversed breadth first, starting at an
+ * element of minimum degree, and visiting the neighbors in the order of
+ * increasing degree. The resulting order is reversed.
+ *
+ * \param[in] elemList Elements in the original order, the element IDs must
+ *	be their position in the list
+ * \param[out] newList Elements in the new order
  */
-void readGmsh(char fileName[STRLEN], double ***vertex, long *nVertices, long ***BCedge,
-		long *nBCedges, long ***tria, long ***quad)
+void orderRCM(elem_t **elemList, elem_t **newList)
 {
-	/* open the mesh file */
-	FILE *meshFile = fopen(fileName, "r");
-	if (!meshFile) {
-		printf("| ERROR: Could not find Mesh File '%s'\n", fileName);
+	int *degree = calloc(nElems, sizeof(int));
+	bool *isVisited = calloc(nElems, sizeof(bool));
+	if (!degree || !isVisited) {
+		printf("| ERROR: could not allocate RCM arrays\n");
 		exit(1);
 	}
 
-	char line[STRLEN];
-
-	/* read in mesh format */
-	int mshFmt;
-	rewind(meshFile);
-	while (fgets(line, sizeof(line), meshFile)) {
-		if (!strcmp(line, "$MeshFormat\n")) {
-			fgets(line, sizeof(line), meshFile);
-			sscanf(line, "%d", &mshFmt);
-			break;
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		side_t *aSide = elemList[iElem]->firstSide;
+		while (aSide) {
+			if (aSide->connection->elem->id >= 0) {
+				degree[iElem]++;
+			}
+			aSide = aSide->nextElemSide;
 		}
 	}
 
-	switch (mshFmt) {
-	case 2: {
-		/* read in number of nodes */
-		*nVertices = 0;
-		rewind(meshFile);
-		while (fgets(line, sizeof(line), meshFile)) {
-			if (!strcmp(line, "$Nodes\n")) {
-				fgets(line, sizeof(line), meshFile);
-				sscanf(line, "%ld", nVertices);
-				break;
+	long head = 0, tail = 0;
+	while (tail < nElems) {
+		/* start a new connected part of the mesh */
+		long iStart = -1;
+		for (long iElem = 0; iElem < nElems; ++iElem) {
+			if ((!isVisited[iElem]) &&
+			    ((iStart < 0) || (degree[iElem] < degree[iStart]))) {
+				iStart = iElem;
 			}
 		}
-		if (*nVertices == 0) {
-			printf("| ERROR: No Nodes in Mesh file\n");
-			exit(1);
-		}
-
-		/* read in nodes */
-		long id;
-		double x, y;
-		*vertex = dyn2DdblArray(*nVertices, 2);
-		for (long iVert = 0; iVert < *nVertices; ++iVert) {
-			fgets(line, sizeof(line), meshFile);
-			sscanf(line, "%ld %lg %lg", &id, &x, &y);
-			if (iVert == id - 1) {
-				(*vertex)[iVert][X] = x;
-				(*vertex)[iVert][Y] = y;
-			} else {
-				printf("| ERROR: NodeID %ld does not match Node Position\n", id);
-				exit(1);
+		isVisited[iStart] = true;
+		newList[tail++] = elemList[iStart];
+
+		while (head < tail) {
+			elem_t *aElem = newList[head++];
+
+			/* append the unvisited neighbors, sorted by degree */
+			long nNew = tail;
+			side_t *aSide = aElem->firstSide;
+			while (aSide) {
+				long iNB = aSide->connection->elem->id;
+				if ((iNB >= 0) && (!isVisited[iNB])) {
+					isVisited[iNB] = true;
+
+					long i = tail++;
+					while ((i > nNew) &&
+					       (degree[newList[i - 1]->id] > degree[iNB])) {
+						newList[i] = newList[i - 1];
+						i--;
+					}
+					newList[i] = elemList[iNB];
+				}
+				aSide = aSide->nextElemSide;
 			}
 		}
+	}
 
-		*nBCedges = nTrias = nQuads = 0;
-
-		/* read in number of elements */
-		long nElem = 0;
-		rewind(meshFile);
-		while (fgets(line, sizeof(line), meshFile)) {
-			if (!strcmp(line, "$Elements\n")) {
-				fgets(line, sizeof(line), meshFile);
-				sscanf(line, "%ld", &nElem);
-				break;
-			}
-		}
-		if (nElem == 0) {
-			printf("| ERROR: No Elements in Mesh file\n");
-			exit(1);
-		}
+	/* reverse the order */
+	for (long iElem = 0; iElem < nElems / 2; ++iElem) {
+		elem_t *tmp = newList[iElem];
+		newList[iElem] = newList[nElems - 1 - iElem];
+		newList[nElems - 1 - iElem] = tmp;
+	}
 
-		/* allocate space for the elements, more than actually necessary,
-		 * because the number of individual elements is not known, will be
-		 * freeed later on though */
-		long **BCedgeTmp = dyn2DintArray(nElem, 3);
-		long **triaTmp = dyn2DintArray(nElem, 4);
-		long **quadTmp = dyn2DintArray(nElem, 5);
-		if (!BCedgeTmp || !triaTmp || !quadTmp) {
-			printf("| ERROR: Not enough memory available\n");
-			exit(1);
-		}
+	free(degree);
+	free(isVisited);
+}
 
-		/* read in elements */
-		int type, nTags, pGroup;
-		char *token, sep[] = " ";
-		for (long iElem = 0; iElem < nElem; ++iElem) {
-			fgets(line, sizeof(line), meshFile);
+/**
+ * \brief Renumber the elements and sides of the mesh for cache locality
+ *
+ * The elements are reordered, such that neighbors are close to each other
+ * in memory. The sides are numbered in the order of their elements, so that
+ * the sides of one element are contiguous, followed by the ghost sides.
+ * The face and boundary side lists are sorted accordingly. The original
+ * element IDs are kept in `fileId` for input and output.
+ */
+void renumberMesh(void)
+{
+	elem_t **elemList = malloc(nElems * sizeof(elem_t *));
+	elem_t **newList = malloc(nElems * sizeof(elem_t *));
+	if (!elemList || !newList) {
+		printf("| ERROR: could not allocate element lists\n");
+		exit(1);
+	}
 
-			/* read element id */
-			token = strtok(line, sep);
-			if (token) {
-				id = strtol(token, NULL, 10);
-			} else {
-				printf("| ERROR: Reading error in gmsh file\n");
-				exit(1);
-			}
+	elem_t *aElem = firstElem;
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		elemList[iElem] = aElem;
+		aElem = aElem->next;
+	}
 
-			/* read element type */
-			token = strtok(NULL, sep);
-			if (token) {
-				type = strtol(token, NULL, 10);
-			} else {
-				printf("| ERROR: Reading error in gmsh file\n");
-				exit(1);
-			}
+	switch (meshRenumbering) {
+	case RENUMBER_RCM:
+		orderRCM(elemList, newList);
+		break;
+	case RENUMBER_HILBERT:
+		orderHilbert(elemList, newList);
+		break;
+	}
 
-			/* read number of integer tags */
-			token = strtok(NULL, sep);
-			if (token) {
-				nTags = strtol(token, NULL, 10);
-			} else {
-				printf("| ERROR: Reading error in gmsh file\n");
-				exit(1);
-			}
+	/* new element IDs and element list */
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		aElem = newList[iElem];
+		aElem->id = iElem;
+		aElem->next = (iElem + 1 < nElems ? newList[iElem + 1] : NULL);
+		linkElemData(aElem, iElem);
+	}
+	firstElem = newList[0];
 
-			/* read physical group, first integer tag */
-			token = strtok(NULL, sep);
-			if (token) {
-				pGroup = strtol(token, NULL, 10);
-			} else {
-				printf("| ERROR: Reading error in gmsh file\n");
-				exit(1);
-			}
+	/* the sides of each element are numbered contiguously */
+	long iSide = 0;
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		side_t *aSide = newList[iElem]->firstSide;
+		while (aSide) {
+			aSide->id = iSide++;
+			linkSideData(aSide);
+			aSide = aSide->nextElemSide;
+		}
+	}
 
-			/* discard rest of tags */
-			for (int iTag = 1; iTag < nTags; ++iTag) {
-				token = strtok(NULL, sep);
-				if (!token) {
-					printf("| ERROR: Reading error in gmsh file\n");
-					exit(1);
-				}
-			}
+	/* boundary sides and ghost elements follow their inner elements */
+	long nBC = 0;
+	sidePtr_t *aBCside = firstBCside;
+	while (aBCside) {
+		nBC++;
+		aBCside = aBCside->next;
+	}
 
-			/* handle different element types */
-			switch (type) {
-			case 1:
-				/* line */
-				if (pGroup > 100) {
-					/* boundary condition */
-					BCedgeTmp[*nBCedges][2] = pGroup;
-
-					/* read two nodes */
-					for (int i = 0; i < 2; ++i) {
-						token = strtok(NULL, sep);
-						if (!token) {
-							printf("| ERROR: Reading error in gmsh file\n");
-							exit(1);
-						}
-						BCedgeTmp[*nBCedges][i] = strtol(token, NULL, 10) - 1;
-					}
+	sortKey_t *keys = malloc(nBC * sizeof(sortKey_t));
+	if (!keys) {
+		printf("| ERROR: could not allocate keys\n");
+		exit(1);
+	}
 
-					(*nBCedges)++;
-				}
-				break;
-			case 2:
-				/* triangle */
-				triaTmp[nTrias][3] = pGroup;
-
-				/* read three nodes */
-				for (int i = 0; i < 3; ++i) {
-					token = strtok(NULL, sep);
-					if (!token) {
-						printf("| ERROR: Reading error in gmsh file\n");
-						exit(1);
-					}
-					triaTmp[nTrias][i] = strtol(token, NULL, 10) - 1;
-				}
+	aBCside = firstBCside;
+	for (long i = 0; i < nBC; ++i) {
+		keys[i].key = aBCside->side->connection->id;
+		keys[i].ptr = aBCside;
+		aBCside = aBCside->next;
+	}
+	qsort(keys, nBC, sizeof(sortKey_t), compareSortKey);
 
-				nTrias++;
+	long nElemsTotal = nElems + nBCsides;
+	long *elemPos = malloc(nElemsTotal * sizeof(long));
+	if (!elemPos) {
+		printf("| ERROR: could not allocate elemPos\n");
+		exit(1);
+	}
 
-				break;
-			case 3:
-				/* quadrilateral */
-				quadTmp[nQuads][4] = pGroup;
-
-				/* read three nodes */
-				for (int i = 0; i < 4; ++i) {
-					token = strtok(NULL, sep);
-					if (!token) {
-						printf("| ERROR: Reading error in gmsh file\n");
-						exit(1);
-					}
-					quadTmp[nQuads][i] = strtol(token, NULL, 10) - 1;
-				}
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		elemPos[newList[iElem] - elemBlock] = iElem;
+	}
 
-				nQuads++;
+	firstBCside = (nBC > 0 ? keys[0].ptr : NULL);
+	for (long i = 0; i < nBC; ++i) {
+		aBCside = keys[i].ptr;
+		aBCside->next = (i + 1 < nBC ? keys[i + 1].ptr : NULL);
 
-				break;
-			}
-		}
+		side_t *gSide = aBCside->side;
+		gSide->id = iSide++;
+		linkSideData(gSide);
+		linkElemData(gSide->elem, nElems + i);
+		elemPos[gSide->elem - elemBlock] = nElems + i;
+	}
+	free(keys);
 
-		/* allocate right amount of space and free temporary space */
-		*BCedge = dyn2DintArray(*nBCedges, 3);
-		if (!*BCedge) {
-			printf("| ERROR: Not enough Memory\n");
-			exit(1);
-		} else {
-			for (long iBCedge = 0; iBCedge < *nBCedges; ++iBCedge) {
-				(*BCedge)[iBCedge][0] = BCedgeTmp[iBCedge][0];
-				(*BCedge)[iBCedge][1] = BCedgeTmp[iBCedge][1];
-				(*BCedge)[iBCedge][2] = BCedgeTmp[iBCedge][2];
-			}
-		}
+	/* faces in the order of their sides */
+	long nFaces = 0;
+	side_t *aSide = firstSide;
+	while (aSide) {
+		nFaces++;
+		aSide = aSide->next;
+	}
 
-		free(BCedgeTmp);
+	keys = malloc(nFaces * sizeof(sortKey_t));
+	if (!keys) {
+		printf("| ERROR: could not allocate keys\n");
+		exit(1);
+	}
 
-		if (nTrias > 0) {
-			*tria = dyn2DintArray(nTrias, 4);
-			if (!*tria) {
-				printf("| ERROR: Not enough Memory\n");
-				exit(1);
-			} else {
-				for (long iTria = 0; iTria < nTrias; ++iTria) {
-					(*tria)[iTria][0] = triaTmp[iTria][0];
-					(*tria)[iTria][1] = triaTmp[iTria][1];
-					(*tria)[iTria][2] = triaTmp[iTria][2];
-					(*tria)[iTria][3] = triaTmp[iTria][3];
-				}
-			}
-		}
+	aSide = firstSide;
+	for (long i = 0; i < nFaces; ++i) {
+		keys[i].key = fmin(aSide->id, aSide->connection->id);
+		keys[i].ptr = aSide;
+		aSide = aSide->next;
+	}
+	qsort(keys, nFaces, sizeof(sortKey_t), compareSortKey);
 
-		free(triaTmp);
+	firstSide = (nFaces > 0 ? keys[0].ptr : NULL);
+	for (long i = 0; i < nFaces; ++i) {
+		aSide = keys[i].ptr;
+		aSide->next = (i + 1 < nFaces ? keys[i + 1].ptr : NULL);
+	}
+	free(keys);
+
+	/* move the elements and sides into storage of the new order, the
+	 * element position is its ID and the side position its side ID */
+	elem_t *newElemBlock = malloc(nElemsTotal * sizeof(elem_t));
+	side_t *newSideBlock = malloc(2 * nSides * sizeof(side_t));
+	if (!newElemBlock || !newSideBlock) {
+		printf("| ERROR: could not allocate elements and sides\n");
+		exit(1);
+	}
 
-		if (nQuads > 0) {
-			*quad = dyn2DintArray(nQuads, 5);
-			if (!*quad) {
-				printf("| ERROR: Not enough Memory\n");
-				exit(1);
-			} else {
-				for (long iQuad = 0; iQuad < nQuads; ++iQuad) {
-					(*quad)[iQuad][0] = quadTmp[iQuad][0];
-					(*quad)[iQuad][1] = quadTmp[iQuad][1];
-					(*quad)[iQuad][2] = quadTmp[iQuad][2];
-					(*quad)[iQuad][3] = quadTmp[iQuad][3];
-					(*quad)[iQuad][4] = quadTmp[iQuad][4];
-				}
-			}
-		}
+#define NEW_ELEM(p) ((p) ? &newElemBlock[elemPos[(p) - elemBlock]] : NULL)
+#define NEW_SIDE(p) ((p) ? &newSideBlock[(p)->id] : NULL)
+	for (long i = 0; i < nElemsTotal; ++i) {
+		elem_t *bElem = &newElemBlock[elemPos[i]];
+		*bElem = elemBlock[i];
+		bElem->next = NEW_ELEM(elemBlock[i].next);
+		bElem->firstSide = NEW_SIDE(elemBlock[i].firstSide);
+	}
 
-		free(quadTmp);
+	for (long i = 0; i < 2 * nSides; ++i) {
+		side_t *bSide = &newSideBlock[sideBlock[i].id];
+		*bSide = sideBlock[i];
+		bSide->connection = NEW_SIDE(sideBlock[i].connection);
+		bSide->nextElemSide = NEW_SIDE(sideBlock[i].nextElemSide);
+		bSide->next = NEW_SIDE(sideBlock[i].next);
+		bSide->elem = NEW_ELEM(sideBlock[i].elem);
+	}
 
-		break;
+	firstElem = NEW_ELEM(firstElem);
+	firstSide = NEW_SIDE(firstSide);
+	aBCside = firstBCside;
+	while (aBCside) {
+		aBCside->side = NEW_SIDE(aBCside->side);
+		aBCside = aBCside->next;
 	}
-	case 4: {
-		/* read curve number of entity tags */
-		long nPEntities, nCEntities;
-		rewind(meshFile);
-		while (fgets(line, sizeof(line), meshFile)) {
-			if (!strcmp(line, "$Entities\n")) {
-				fgets(line, sizeof(line), meshFile);
-				sscanf(line, "%ld %ld", &nPEntities, &nCEntities);
-				break;
-			}
-		}
-		if (nCEntities == 0) {
-			printf("| ERROR: No curves in mesh file\n");
-			exit(1);
-		}
+#undef NEW_ELEM
+#undef NEW_SIDE
 
-		/* read curve entity tags */
-		int pTag[nCEntities];
-		int iCentitiy = 0;
-		char *token, sep[] = " ";
-		for (int l = 0; l < nPEntities; l++) {
-			/* skip point tags */
-			fgets(line, sizeof(line), meshFile);
-		}
-		for (int l = 0; l < nCEntities; l++) {
-			fgets(line, sizeof(line), meshFile);
+	free(elemBlock);
+	free(sideBlock);
+	elemBlock = newElemBlock;
+	sideBlock = newSideBlock;
 
-			token = strtok(line, sep);
-			for (int k = 0; k < 7; ++k) {
-				token = strtok(NULL, sep);
-			}
-			int numPtags = strtol(token, NULL, 10);
+	free(elemPos);
+	free(elemList);
+	free(newList);
+}
 
-			if (numPtags) {
-				token = strtok(NULL, sep);
-				pTag[iCentitiy++] = strtol(token, NULL, 10);
-			}
-		}
+/**
+ * \brief Create the compressed element to side connectivity
+ *
+ * For every element, the side IDs and the state indices of the neighbor
+ * elements are stored contiguously in the order of the element's side list.
+ * The neighbor index addresses the `elemData` arrays, which includes the
+ * ghost elements and the periodic neighbors.
+ */
+void createElemSideConnectivity(void)
+{
+	elemSideStart = malloc((nElems + 1) * sizeof(long));
+	if (!elemSideStart) {
+		printf("| ERROR: could not allocate elemSideStart\n");
+		exit(1);
+	}
 
-		/* read in number of entity block and number of nordes */
-		*nVertices = 0;
-		int nEblocks;
-		rewind(meshFile);
-		while (fgets(line, sizeof(line), meshFile)) {
-			if (!strcmp(line, "$Nodes\n")) {
-				fgets(line, sizeof(line), meshFile);
-				sscanf(line, "%d %ld", &nEblocks, nVertices);
-				break;
-			}
-		}
-		if (*nVertices == 0) {
-			printf("| ERROR: No Nodes in Mesh file\n");
-			exit(1);
+	elemSideStart[0] = 0;
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		int nElemSides = 0;
+		side_t *aSide = elem[iElem]->firstSide;
+		while (aSide) {
+			nElemSides++;
+			aSide = aSide->nextElemSide;
 		}
+		elemSideStart[iElem + 1] = elemSideStart[iElem] + nElemSides;
+	}
 
-		/* read in nodes */
-		long id[*nVertices];
-		long nNinB, iVert = 0, iId = 0;
-		double x, y;
-		*vertex = dyn2DdblArray(*nVertices, 2);
-		for (int e = 0; e < nEblocks; ++e) {
-			fgets(line, sizeof(line), meshFile);
-
-			/* read number of nodes in block */
-			sscanf(line, "%*d %*d %*d %ld", &nNinB);
-
-			/* read ids */
-			for (long i = 0; i < nNinB; ++i) {
-				fgets(line, sizeof(line), meshFile);
-				sscanf(line, "%ld", &id[iId++]);
-			}
-
-			/* read coordinates */
-			for (long i = 0; i < nNinB; ++i) {
-				fgets(line, sizeof(line), meshFile);
-				sscanf(line, "%lg %lg", &x, &y);
+	elemSide = malloc(elemSideStart[nElems] * sizeof(long));
+	elemNB = malloc(elemSideStart[nElems] * sizeof(long));
+	if (!elemSide || !elemNB) {
+		printf("| ERROR: could not allocate elemSide\n");
+		exit(1);
+	}
 
-				if (iVert == id[iVert] - 1) {
-					(*vertex)[iVert  ][X] = x;
-					(*vertex)[iVert++][Y] = y;
-				} else {
-					printf("| ERROR: NodeID %ld does not match Node Position\n", id[iVert]);
-					exit(1);
-				}
-			}
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		long k = elemSideStart[iElem];
+		side_t *aSide = elem[iElem]->firstSide;
+		while (aSide) {
+			elemSide[k] = aSide->id;
+			elemNB[k] = (double (*)[NVAR])aSide->connection->elem->pVar
+				- elemData.pVar;
+			k++;
+			aSide = aSide->nextElemSide;
 		}
+	}
+}
 
-		*nBCedges = nTrias = nQuads = 0;
+/**
+ * \brief Fill the global element, side and BC side pointer arrays from the
+ *	lists and create the element to side connectivity
+ */
+void createElemSideLists(void)
+{
+	/* element and side lists */
+	side = calloc(nSides, sizeof(side_t *));
+	if (!side) {
+		printf("| ERROR: could not allocate side\n");
+		exit(1);
+	}
 
-		/* read in number of element blocks and number of elements */
-		long nElem = 0;
-		rewind(meshFile);
-		while (fgets(line, sizeof(line), meshFile)) {
-			if (!strcmp(line, "$Elements\n")) {
-				fgets(line, sizeof(line), meshFile);
-				sscanf(line, "%d %ld", &nEblocks, &nElem);
-				break;
-			}
-		}
-		if (nElem == 0) {
-			printf("| ERROR: No Elements in Mesh file\n");
-			exit(1);
-		}
+	elem = calloc(nElems, sizeof(elem_t *));
+	if (!elem) {
+		printf("| ERROR: could not allocate elem\n");
+		exit(1);
+	}
 
-		/* allocate space for the elements, more than actually necessary,
-		 * because the number of individual elements is not known, will be
-		 * freeed later on though */
-		long **BCedgeTmp = dyn2DintArray(nElem, 3);
-		long **triaTmp = dyn2DintArray(nElem, 4);
-		long **quadTmp = dyn2DintArray(nElem, 5);
-		if (!BCedgeTmp || !triaTmp || !quadTmp) {
-			printf("| ERROR: Not enough memory available\n");
-			exit(1);
-		}
+	BCside = calloc(nBCsides, sizeof(side_t *));
+	if (!BCside) {
+		printf("| ERROR: could not allocate BCside\n");
+		exit(1);
+	}
 
-		/* read in elements */
-		int type;
-		for (int e = 0; e < nEblocks; ++e) {
-			fgets(line, sizeof(line), meshFile);
+	elem_t *aElem = firstElem;
+	long iElem = 0;
+	while (aElem) {
+		elem[iElem++] = aElem;
+		aElem = aElem->next;
+	}
 
-			/* read element type and number of elements in block */
-			sscanf(line, "%*d %*d %d %ld", &type, &nNinB);
+	side_t *aSide = firstSide;
+	long iSide = 0;
+	while (aSide) {
+		side[iSide++] = aSide;
+		aSide = aSide->next;
+	}
 
-			/* handle different element types */
-			switch (type) {
-			case 1:
-				/* line */
-				for (long i = 0; i < nNinB; ++i) {
-					/* boundary condition */
-					BCedgeTmp[*nBCedges][2] = pTag[e];
+	sidePtr_t *aBCside = firstBCside;
+	iSide = 0;
+	while (aBCside) {
+		if (aBCside->side->BC->BCtype != PERIODIC) {
+			BCside[iSide++] = aBCside->side;
+		}
 
-					/* read two nodes */
-					fgets(line, sizeof(line), meshFile);
-					sscanf(line, "%*d %ld %ld",
-							&BCedgeTmp[*nBCedges][0],
-							&BCedgeTmp[*nBCedges][1]);
+		aBCside = aBCside->next;
+	}
+	nBCsides = iSide;
 
-					BCedgeTmp[*nBCedges][0]--;
-					BCedgeTmp[*nBCedges][1]--;
+	createElemSideConnectivity();
+}
 
-					(*nBCedges)++;
-				}
-				break;
-			case 2:
-				/* triangle */
-				for (long i = 0; i < nNinB; ++i) {
-					triaTmp[nTrias][3] = 1;
-
-					/* read three nodes */
-					fgets(line, sizeof(line), meshFile);
-					sscanf(line, "%*d %ld %ld %ld",
-							&triaTmp[nTrias][0],
-							&triaTmp[nTrias][1],
-							&triaTmp[nTrias][2]);
-
-					triaTmp[nTrias][0]--;
-					triaTmp[nTrias][1]--;
-					triaTmp[nTrias][2]--;
+/**
+ * \brief Create a cartesian mesh
+ * \param[in,out] vertex Pointer to 2D array, used for the vertices
+ * \param[in,out] nVertices Pointer to the number of total vertices in `vertex`
+ * \param[in,out] BCedge Pointer to 2D array, used for the BC edges
+ * \param[in,out] nBCedges Pointer to the number of total BC edges
+ * \param[in,out] quad Pointer to a 2D array, used for the quadrangles
+ */
+void createCartMesh(
+	double ***vertex, long *nVertices, long ***BCedge, long *nBCedges, long ***quad)
+{
+	/* set up necessary variables */
+	long iMax = cartMesh.iMax;
+	long jMax = cartMesh.jMax;
 
-					nTrias++;
-				}
+	*nVertices = (iMax + 1) * (jMax + 1);
+	nQuads = iMax * jMax;
+	*nBCedges = 2 * (iMax + jMax);
 
-				break;
-			case 3:
-				/* quadrilateral */
-				for (long i = 0; i < nNinB; ++i) {
-					quadTmp[nQuads][4] = 1;
-
-					/* read three nodes */
-					fgets(line, sizeof(line), meshFile);
-					sscanf(line, "%*d %ld %ld %ld %ld",
-							&quadTmp[nQuads][0],
-							&quadTmp[nQuads][1],
-							&quadTmp[nQuads][2],
-							&quadTmp[nQuads][3]);
-
-					quadTmp[nQuads][0]--;
-					quadTmp[nQuads][1]--;
-					quadTmp[nQuads][2]--;
-					quadTmp[nQuads][3]--;
+	double dx = (xMax - xMin) / iMax;
+	double dy = (yMax - yMin) / jMax;
 
-					nQuads++;
-				}
+	*quad = dyn2DintArray(nQuads, 5);
+	*BCedge = dyn2DintArray(*nBCedges, 3);
+	*vertex = dyn2DdblArray(*nVertices, 2);
 
-				break;
-			}
+	/* build vertices */
+	double y = yMin, x;
+	long k = 0;
+	for (long j = 0; j < jMax + 1; ++j) {
+		x = xMin;
+		for (long i = 0; i < iMax + 1; ++i) {
+			(*vertex)[k][X] = x;
+			(*vertex)[k][Y] = y;
+			k++;
+			x += dx;
 		}
+		y += dy;
+	}
 
-		/* allocate right amount of space and free temporary space */
-		*BCedge = dyn2DintArray(*nBCedges, 3);
-		if (!*BCedge) {
-			printf("| ERROR: Not enough Memory\n");
-			exit(1);
-		} else {
-			for (long iBCedge = 0; iBCedge < *nBCedges; ++iBCedge) {
-				(*BCedge)[iBCedge][0] = BCedgeTmp[iBCedge][0];
-				(*BCedge)[iBCedge][1] = BCedgeTmp[iBCedge][1];
-				(*BCedge)[iBCedge][2] = BCedgeTmp[iBCedge][2];
-			}
+	/* build elements */
+	k = 0;
+	for (long j = 0; j < jMax; ++j) {
+		for (long i = 0; i < iMax; ++i) {
+			(*quad)[k][0] = k + j;
+			(*quad)[k][1] = (*quad)[k][0] + 1;
+			(*quad)[k][2] = (*quad)[k][1] + iMax + 1;
+			(*quad)[k][3] = (*quad)[k][2] - 1;
+			(*quad)[k][4] = 1;
+			k++;
 		}
+	}
 
-		free(BCedgeTmp);
-
-		if (nTrias > 0) {
-			*tria = dyn2DintArray(nTrias, 4);
-			if (!*tria) {
-				printf("| ERROR: Not enough Memory\n");
-				exit(1);
-			} else {
-				for (long iTria = 0; iTria < nTrias; ++iTria) {
-					(*tria)[iTria][0] = triaTmp[iTria][0];
-					(*tria)[iTria][1] = triaTmp[iTria][1];
-					(*tria)[iTria][2] = triaTmp[iTria][2];
-					(*tria)[iTria][3] = triaTmp[iTria][3];
-				}
-			}
+	/* build BCedges */
+	k = 0;
+	/* bottom side */
+	printf("| Bottom Side:\n");
+	printf("|   # of BCs: %d\n", cartMesh.nBC[BOTTOM]);
+	for (int iBC = 0; iBC < cartMesh.nBC[BOTTOM]; ++iBC) {
+		printf("|   BC Type : %d\n", cartMesh.BCtype[BOTTOM][iBC]);
+		printf("|   BC Range: %d -- %d\n", cartMesh.BCrange[BOTTOM][iBC][0], cartMesh.BCrange[BOTTOM][iBC][1]);
+		for (int i = cartMesh.BCrange[BOTTOM][iBC][0] - 1; i < cartMesh.BCrange[BOTTOM][iBC][1]; ++i) {
+			(*BCedge)[k][0] = i;
+			(*BCedge)[k][1] = i + 1;
+			(*BCedge)[k][2] = cartMesh.BCtype[BOTTOM][iBC];
+			k++;
 		}
-		free(triaTmp);
-
-		if (nQuads > 0) {
-			*quad = dyn2DintArray(nQuads, 5);
-			if (!*quad) {
-				printf("| ERROR: Not enough Memory\n");
-				exit(1);
-			} else {
-				for (long iQuad = 0; iQuad < nQuads; ++iQuad) {
-					(*quad)[iQuad][0] = quadTmp[iQuad][0];
-					(*quad)[iQuad][1] = quadTmp[iQuad][1];
-					(*quad)[iQuad][2] = quadTmp[iQuad][2];
-					(*quad)[iQuad][3] = quadTmp[iQuad][3];
-					(*quad)[iQuad][4] = quadTmp[iQuad][4];
-				}
-			}
+	}
+	/* right side */
+	printf("| Right Side:\n");
+	printf("|   # of BCs: %d\n", cartMesh.nBC[RIGHT]);
+	for (int iBC = 0; iBC < cartMesh.nBC[RIGHT]; ++iBC) {
+		printf("|   BC Type : %d\n", cartMesh.BCtype[RIGHT][iBC]);
+		printf("|   BC Range: %d -- %d\n", cartMesh.BCrange[RIGHT][iBC][0], cartMesh.BCrange[RIGHT][iBC][1]);
+		for (int j = cartMesh.BCrange[RIGHT][iBC][0] - 1; j < cartMesh.BCrange[RIGHT][iBC][1]; ++j) {
+			(*BCedge)[k][0] = (iMax + 1) * (j + 1) - 1;
+			(*BCedge)[k][1] = (iMax + 1) * (j + 2) - 1;
+			(*BCedge)[k][2] = cartMesh.BCtype[RIGHT][iBC];
+			k++;
 		}
-		free(quadTmp);
-
-		break;
 	}
-	default:
-		printf("| ERROR: Wrong gmsh Mesh Format '%d'\n", mshFmt);
-		exit(1);
+	/* top side */
+	printf("| Top Side:\n");
+	printf("|   # of BCs: %d\n", cartMesh.nBC[TOP]);
+	for (int iBC = 0; iBC < cartMesh.nBC[TOP]; ++iBC) {
+		printf("|   BC Type : %d\n", cartMesh.BCtype[TOP][iBC]);
+		printf("|   BC Range: %d -- %d\n", cartMesh.BCrange[TOP][iBC][0], cartMesh.BCrange[TOP][iBC][1]);
+		for (int i = cartMesh.BCrange[TOP][iBC][0] - 1; i < cartMesh.BCrange[TOP][iBC][1]; ++i) {
+			(*BCedge)[k][0] = (iMax + 1) * jMax + i;
+			(*BCedge)[k][1] = (*BCedge)[k][0] + 1;
+			(*BCedge)[k][2] = cartMesh.BCtype[TOP][iBC];
+			k++;
+		}
+	}
+	/* left side */
+	printf("| Left Side:\n");
+	printf("|   # of BCs: %d\n", cartMesh.nBC[LEFT]);
+	for (int iBC = 0; iBC < cartMesh.nBC[LEFT]; ++iBC) {
+		printf("|   BC Type : %d\n", cartMesh.BCtype[LEFT][iBC]);
+		printf("|   BC Range: %d -- %d\n", cartMesh.BCrange[LEFT][iBC][0], cartMesh.BCrange[LEFT][iBC][1]);
+		for (int j = cartMesh.BCrange[LEFT][iBC][0] - 1; j < cartMesh.BCrange[LEFT][iBC][1]; ++j) {
+			(*BCedge)[k][0] = j * (iMax + 1);
+			(*BCedge)[k][1] = (*BCedge)[k][0] + iMax + 1;
+			(*BCedge)[k][2] = cartMesh.BCtype[LEFT][iBC];
+			k++;
+		}
 	}
 
-	fclose(meshFile);
-
-	printf("| %7ld Nodes read\n", *nVertices);
-	printf("| %7ld Triangles read\n", nTrias);
-	printf("| %7ld Quadrangles read\n", nQuads);
-	printf("| %7ld Boundary Edges read\n", *nBCedges);
+	free(cartMesh.nBC);
 }
 
 /**
@@ -1450,6 +1553,22 @@ void createMesh(void)
 	nSides = nInnerSides + nBCedges;
 	nNodes = 0;
 
+	/* state of the inner and ghost elements, and of both sides of each
+	 * face */
+	createStateData(nElems + nBCsides, 2 * nSides);
+
+	elemBlock = calloc(nElems + nBCsides, sizeof(elem_t));
+	sideBlock = calloc(2 * nSides, sizeof(side_t));
+	if (!elemBlock || !sideBlock) {
+		printf("| ERROR: could not allocate elements and sides\n");
+		exit(1);
+	}
+
+	/* nodes, element node arrays, BC side list and Gaussian points of
+	 * the elements are placed into the arena */
+	arenaInit(&meshArena, nVertices * sizeof(node_t)
+			+ nBCsides * sizeof(sidePtr_t) + nElems * 256);
+
 	/* create nodes */
 	node_t **vertexPtr = calloc(nVertices, sizeof(node_t *));
 
@@ -1460,11 +1579,7 @@ void createMesh(void)
 
 	firstNode = NULL;
 	for (long iNode = nVertices - 1; iNode >= 0; --iNode) {
-		node_t *aNode = calloc(1, sizeof(node_t));
-		if (!aNode) {
-			printf("| ERROR: could not allocate aNode\n");
-			exit(1);
-		}
+		node_t *aNode = arenaAlloc(&meshArena, sizeof(node_t));
 
 		aNode->id = iNode;
 		aNode->x[X] = vertex[iNode][X];
@@ -1493,14 +1608,12 @@ void createMesh(void)
 	/* loop over all triangles */
 	elem_t *prevElem = NULL;
 	for (long iTria = 0; iTria < nTrias; ++iTria) {
-		elem_t *aElem = calloc(1, sizeof(elem_t));
-		if (!aElem) {
-			printf("| ERROR: could not allocate aElem\n");
-			exit(1);
-		}
+		elem_t *aElem = &elemBlock[iElem];
 
 		aElem->id = iElem++;
+		aElem->fileId = aElem->id;
 		aElem->elemType = 3;
+		linkElemData(aElem, aElem->id);
 		aElem->domain = tria[iTria][aElem->elemType];
 
 		if (!firstElem) {
@@ -1512,11 +1625,8 @@ void createMesh(void)
 		}
 		aElem->next = NULL;
 
-		aElem->node = calloc(aElem->elemType, sizeof(node_t *));
-		if (!aElem->node) {
-			printf("| ERROR: could not allocate aElem->node\n");
-			exit(1);
-		}
+		aElem->node = arenaAlloc(&meshArena,
+				aElem->elemType * sizeof(node_t *));
 
 		for (int iNode = 0; iNode < aElem->elemType; ++iNode) {
 			aElem->node[iNode] = vertexPtr[tria[iTria][iNode]];
@@ -1530,13 +1640,10 @@ void createMesh(void)
 
 		aElem->firstSide = NULL;
 		for (int iSide = 0; iSide < aElem->elemType; ++iSide) {
-			side_t *aSide = calloc(1, sizeof(side_t));
-			if (!aSide) {
-				printf("| ERROR: could not allocate aSide\n");
-				exit(1);
-			}
+			side_t *aSide = &sideBlock[iSidePtr];
 
 			aSide->id = iSidePtr;
+			linkSideData(aSide);
 			aSide->connection = NULL;
 			aSide->nextElemSide = NULL;
 			aSide->next = NULL;
@@ -1570,14 +1677,12 @@ void createMesh(void)
 
 	/* loop over all quadrilaterals */
 	for (long iQuad = 0; iQuad < nQuads; ++iQuad) {
-		elem_t *aElem = calloc(1, sizeof(elem_t));
-		if (!aElem) {
-			printf("| ERROR: could not allocate aElem\n");
-			exit(0);
-		}
+		elem_t *aElem = &elemBlock[iElem];
 
 		aElem->id = iElem++;
+		aElem->fileId = aElem->id;
 		aElem->elemType = 4;
+		linkElemData(aElem, aElem->id);
 		aElem->domain = quad[iQuad][aElem->elemType];
 
 		if (!firstElem) {
@@ -1589,11 +1694,8 @@ void createMesh(void)
 		}
 		aElem->next = NULL;
 
-		aElem->node = calloc(aElem->elemType, sizeof(node_t *));
-		if (!aElem->node) {
-			printf("| ERROR: could not allocate aElem->node\n");
-			exit(0);
-		}
+		aElem->node = arenaAlloc(&meshArena,
+				aElem->elemType * sizeof(node_t *));
 
 		for (int iNode = 0; iNode < aElem->elemType; ++iNode) {
 			aElem->node[iNode] = vertexPtr[quad[iQuad][iNode]];
@@ -1607,13 +1709,10 @@ void createMesh(void)
 
 		aElem->firstSide = NULL;
 		for (int iSide = 0; iSide < aElem->elemType; ++iSide) {
-			side_t *aSide = calloc(1, sizeof(side_t));
-			if (!aSide) {
-				printf("| ERROR: could not allocate aSide\n");
-				exit(0);
-			}
+			side_t *aSide = &sideBlock[iSidePtr];
 
 			aSide->id = iSidePtr;
+			linkSideData(aSide);
 			aSide->connection = NULL;
 			aSide->nextElemSide = NULL;
 			aSide->next = NULL;
@@ -1649,26 +1748,21 @@ void createMesh(void)
 	/* sides and connectivity */
 	/* save all BCedges into the sideList array */
 	for (long iSide = 0; iSide < nBCsides; ++iSide) {
-		side_t *aSide = calloc(1, sizeof(side_t));
-		if (!aSide) {
-			printf("| ERROR: could not allocate aSide\n");
-			exit(0);
-		}
+		side_t *aSide = &sideBlock[iSidePtr];
 
 		aSide->id = iSidePtr;
+		linkSideData(aSide);
 		aSide->connection = NULL;
 		aSide->nextElemSide = NULL;
 		aSide->next = NULL;
 		aSide->node[0] = vertexPtr[BCedge[iSide][0]];
 		aSide->node[1] = vertexPtr[BCedge[iSide][1]];
 
-		elem_t *aElem = calloc(1, sizeof(elem_t));
-		if (!aElem) {
-			printf("| ERROR: could not allocate aElem\n");
-			exit(0);
-		}
+		elem_t *aElem = &elemBlock[nElems + iSide];
 
 		aElem->id = -1;
+		aElem->fileId = -1;
+		linkElemData(aElem, nElems + iSide);
 		aSide->elem = aElem;
 
 		long iNode1 = vertexPtr[BCedge[iSide][0]]->id;
@@ -1736,11 +1830,8 @@ void createMesh(void)
 			}
 
 			/* save boundary side (bSide) into boundary side list */
-			sidePtr_t *aBCside = calloc(1, sizeof(sidePtr_t));
-			if (!aBCside) {
-				printf("| ERROR: could not allocate aBCside\n");
-				exit(1);
-			}
+			sidePtr_t *aBCside = arenaAlloc(&meshArena,
+					sizeof(sidePtr_t));
 
 			aBCside->side = bSide;
 			aBCside->next = firstBCside;
@@ -1755,6 +1846,11 @@ void createMesh(void)
 	}
 	free(sideList);
 
+	/* renumbering of elements and sides */
+	if (meshRenumbering != RENUMBER_NONE) {
+		renumberMesh();
+	}
+
 	/* extend element info: area and projection of cell onto axes */
 	totalArea_q = 0.0;
 	elem_t *aElem = firstElem;
@@ -1798,49 +1894,7 @@ void createMesh(void)
 		aElem = aElem->next;
 	}
 
-	/* element and side lists */
-	side = calloc(nSides, sizeof(side_t *));
-	if (!side) {
-		printf("| ERROR: could not allocate side\n");
-		exit(1);
-	}
-
-	elem = calloc(nElems, sizeof(elem_t *));
-	if (!elem) {
-		printf("| ERROR: could not allocate elem\n");
-		exit(1);
-	}
-
-	BCside = calloc(nBCsides, sizeof(side_t *));
-	if (!BCside) {
-		printf("| ERROR: could not allocate BCside\n");
-		exit(1);
-	}
-
-	aElem = firstElem;
-	iElem = 0;
-	while (aElem) {
-		elem[iElem++] = aElem;
-		aElem = aElem->next;
-	}
-
-	aSide = firstSide;
-	long iSide = 0;
-	while (aSide) {
-		side[iSide++] = aSide;
-		aSide = aSide->next;
-	}
-
-	aBCside = firstBCside;
-	iSide = 0;
-	while (aBCside) {
-		if (aBCside->side->BC->BCtype != PERIODIC) {
-			BCside[iSide++] = aBCside->side;
-		}
-
-		aBCside = aBCside->next;
-	}
-	nBCsides = iSide;
+	createElemSideLists();
 }
 
 /**
@@ -1906,6 +1960,23 @@ void readMesh(void)
 		printf("ERROR: Mesh type can only be unstructured(=0) or cartesian(=1)\n");
 		exit(1);
 	}
+
+	meshRenumbering = getInt("meshRenumbering", "0");
+	switch (meshRenumbering) {
+	case RENUMBER_NONE:
+		break;
+	case RENUMBER_RCM:
+		printf("| Renumbering: Reverse Cuthill-McKee\n");
+		break;
+	case RENUMBER_HILBERT:
+		printf("| Renumbering: Hilbert Curve\n");
+		break;
+	default:
+		printf("| ERROR: Mesh renumbering must be 0, 1 or 2\n");
+		exit(1);
+	}
+
+	useMeshCache = getBool("meshCache", "F");
 }
 
 /**
@@ -1916,7 +1987,18 @@ void initMesh(void)
 	printf("\nInitializing Mesh:\n");
 	readMesh();
 	strcat(strcpy(gridFile, strOutFile), "_mesh.cgns");
-	createMesh();
+	if (useMeshCache) {
+		/* the processed mesh is reused if neither the mesh nor its
+		 * parameters have changed */
+		uint64_t key = meshCacheKey();
+		strcat(strcpy(meshCacheFile, strOutFile), "_mesh.cache");
+		if (!readMeshCache(meshCacheFile, key)) {
+			createMesh();
+			writeMeshCache(meshCacheFile, key);
+		}
+	} else {
+		createMesh();
+	}
 	if ((iVisuProg == CGNS) && (!isRestart)) {
 		cgnsWriteMesh();
 	}
@@ -1928,57 +2010,29 @@ void initMesh(void)
  */
 void freeMesh(void)
 {
-	/* free all nodes */
-	node_t *aNode = firstNode;
-	while (aNode) {
-		if (aNode->next) {
-			node_t *tmp = aNode;
-			aNode = aNode->next;
-			free(tmp);
-		} else {
-			free(aNode);
-			break;
-		}
-	}
-
-	/* free all elements and their corresponding sides */
-	for (long iElem = 0; iElem < nElems; ++iElem) {
-		elem_t *aElem = elem[iElem];
-		free(aElem->xGP);
-		free(aElem->wGP);
-		free(aElem->node);
-
-		side_t *aSide = aElem->firstSide;
-		while (aSide) {
-			if (aSide->nextElemSide) {
-				side_t *tmp = aSide;
-				aSide = aSide->nextElemSide;
-				free(tmp);
-			} else {
-				free(aSide);
-				break;
-			}
-		}
+	/* nodes, element node arrays, Gaussian points and the BC side list */
+	arenaFree(&meshArena);
 
-		free(aElem);
-	}
+	/* elements and sides */
+	free(elemBlock);
+	free(sideBlock);
 	free(elem);
 	free(side);
-
-	/* free all BC sides */
-	sidePtr_t *aBCside = firstBCside;
-	while (aBCside) {
-		if (aBCside->next) {
-			sidePtr_t *tmp = aBCside;
-			aBCside = aBCside->next;
-			free(tmp->side->elem);
-			free(tmp->side);
-			free(tmp);
-		} else {
-			free(aBCside->side->elem);
-			free(aBCside->side);
-			free(aBCside);
-			break;
-		}
-	}
+	free(elemSideStart);
+	free(elemSide);
+	free(elemNB);
+
+	free(elemData.pVar);
+	free(elemData.cVar);
+	free(elemData.cVarStage);
+	free(elemData.u_x);
+	free(elemData.u_y);
+	free(elemData.u_t);
+	free(elemData.source);
+	free(elemData.dt);
+
+	free(sideData.n);
+	free(sideData.len);
+	free(sideData.GP);
+	free(sideData.w);
 }
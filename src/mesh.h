@@ -14,9 +14,12 @@ typedef struct elem_t elem_t;
 typedef struct side_t side_t;
 typedef struct sidePtr_t sidePtr_t;
 typedef struct cartMesh_t cartMesh_t;
+typedef struct elemData_t elemData_t;
+typedef struct sideData_t sideData_t;
 
 #include "main.h"
 #include "boundary.h"
+#include "memTools.h"
 
 /**
  * \brief Structure for a single node in a linked list of nodes
@@ -35,17 +38,14 @@ struct side_t {
 	int BCtype;			/**< boundary condition type */
 	int BCid;			/**< boundary condition Sub-ID */
 	boundary_t *BC;			/**< pointer to the boundary condition */
-	double pVar[NVAR];		/**< primitive variables state at side */
-	double n[NDIM];			/**< normal vector of side */
-	double len;			/**< length of the side */
+	double *n;			/**< normal vector of side */
 	double baryBaryVec[NDIM];	/**< vector from element barycenter to
 						barycenter of neighbor element */
 	double baryBaryDist;		/**< length of `baryBaryVec` */
-	double GP[NDIM];		/**< vector from element barycenter to
+	double *GP;			/**< vector from element barycenter to
 						the Gaussian point of the side */
-	double w[NDIM];			/**< omegaX and omegaY entries for 2nd
+	double *w;			/**< omegaX and omegaY entries for 2nd
 						order gradient reconstruction */
-	double flux[NVAR];		/**< numerical flux of the side */
 	side_t *connection;		/**< neighbor side */
 	side_t *nextElemSide;		/**< pointer to the next side of the
 						element */
@@ -71,22 +71,22 @@ struct elem_t {
 	int elemType;			/**< element type: triangle (3) or
 						quadrangle (4) */
 	long id;			/**< unique element Id */
+	long fileId;			/**< element ID in the mesh file, used
+						for input and output */
 	int domain;			/**< flow domain number */
 	double bary[NDIM];		/**< coordinates ob element barycenter */
 	double sx;			/**< cell extension in x-direction */
 	double sy;			/**< cell extension in y-direction */
 	double area;			/**< area of the element */
 	double areaq;			/**< inverse of element area */
-	double pVar[NVAR];		/**< primitive variables of element */
-	double cVar[NVAR];		/**< conservative variables of element */
-	double cVarStage[NVAR];		/**< conservative variables at initial
+	double *pVar;			/**< primitive variables of element */
+	double *cVar;			/**< conservative variables of element */
+	double *cVarStage;		/**< conservative variables at initial
 						Runge-Kutta stage */
-	double u_x[NVAR];		/**< x-gradient of primitive variables */
-	double u_y[NVAR];		/**< y-gradient of primitive variables */
-	double u_t[NVAR];		/**< t-gradient of primitive variables */
-	double source[NVAR];		/**< source term */
-	double dt;			/**< element time step */
-	double dtLoc;			/**< local element time step */
+	double *u_x;			/**< x-gradient of primitive variables */
+	double *u_y;			/**< y-gradient of primitive variables */
+	double *u_t;			/**< t-gradient of primitive variables */
+	double *source;			/**< source term */
 	double venkEps_sq;		/**< Venkatakrishnan limiter constant
 						for element */
 	int innerSides;			/**< number of non-BC sides of element */
@@ -99,6 +99,42 @@ struct elem_t {
 	node_t **node;			/**< pointer array of the element's nodes */
 };
 
+/**
+ * \brief Contiguous storage of the element state
+ *
+ * The arrays are indexed by the element ID, the ghost elements of the
+ * boundary sides are stored behind the `nElems` inner elements. The state
+ * arrays of `elem_t` point into these arrays.
+ */
+struct elemData_t {
+	long nElems;			/**< number of inner and ghost elements */
+	double (*pVar)[NVAR];		/**< primitive variables */
+	double (*cVar)[NVAR];		/**< conservative variables */
+	double (*cVarStage)[NVAR];	/**< conservative variables at initial
+						Runge-Kutta stage */
+	double (*u_x)[NVAR];		/**< x-gradient of primitive variables */
+	double (*u_y)[NVAR];		/**< y-gradient of primitive variables */
+	double (*u_t)[NVAR];		/**< t-gradient of primitive variables */
+	double (*source)[NVAR];	/**< source term */
+	double *dt;			/**< element time step */
+};
+
+/**
+ * \brief Contiguous storage of the side state
+ *
+ * The arrays are indexed by the side ID, which covers both sides of every
+ * face. The state arrays of `side_t` point into these arrays.
+ */
+struct sideData_t {
+	long nSides;			/**< number of sides */
+	double (*n)[NDIM];		/**< normal vector of side */
+	double *len;			/**< length of the side */
+	double (*GP)[NDIM];		/**< vector from element barycenter to
+						the Gaussian point of the side */
+	double (*w)[NDIM];		/**< omegaX and omegaY entries for 2nd
+						order gradient reconstruction */
+};
+
 /**
  * \brief Structure holding the information for a cartesian mesh
  */
@@ -119,6 +155,7 @@ extern char gridFile[STRLEN];
 
 extern int meshType;
 extern int meshFormat;
+extern int meshRenumbering;
 
 extern long nNodes;
 
@@ -137,6 +174,17 @@ extern double yMin;
 extern double yMax;
 extern double dxRef;
 
+extern elemData_t elemData;
+extern sideData_t sideData;
+
+extern elem_t *elemBlock;
+extern side_t *sideBlock;
+extern arena_t meshArena;
+
+extern long *elemSideStart;
+extern long *elemSide;
+extern long *elemNB;
+
 extern elem_t **elem;
 extern side_t **side;
 extern side_t **BCside;
@@ -146,6 +194,10 @@ extern node_t *firstNode;
 extern side_t *firstSide;
 extern sidePtr_t *firstBCside;
 
+void createStateData(long nElemsTotal, long nSidesTotal);
+void linkElemData(elem_t *aElem, long iData);
+void linkSideData(side_t *aSide);
+void createElemSideLists(void);
 void initMesh(void);
 void freeMesh(void);
 
@@ -0,0 +1,601 @@
+/** \file
+ *
+ * \brief Binary cache of the fully processed mesh
+ *
+ * The cache holds the nodes, elements and sides after renumbering,
+ * periodic matching and the computation of the reconstruction weights and
+ * Gaussian points. All pointers are stored as indices into the element and
+ * side blocks, they are restored when the cache is loaded. The cache is
+ * identified by a key over the mesh file, or the parameters of the
+ * cartesian mesh, and all other parameters that change the processed mesh.
+ * Its content is protected by a checksum. The file is written in the byte
+ * order of the machine and is not meant to be portable.
+ *
+ * \author hhh
+ * \date Sun 18 Oct 2026 02:27:15 PM CEST
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+typedef struct meshCacheHeader_t meshCacheHeader_t;
+typedef struct cacheElem_t cacheElem_t;
+typedef struct cacheSide_t cacheSide_t;
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "main.h"
+#include "meshCache.h"
+#include "mesh.h"
+#include "boundary.h"
+#include "memTools.h"
+
+#define MESH_CACHE_VERSION 1		/**< version of the cache layout */
+#define FNV_OFFSET 14695981039346656037UL	/**< FNV-1a offset basis */
+#define FNV_PRIME 1099511628211UL	/**< FNV-1a prime */
+
+/**
+ * \brief Header of the mesh cache file
+ */
+struct meshCacheHeader_t {
+	char magic[8];			/**< file identifier "CCFDMESH" */
+	long version;			/**< version of the cache layout */
+	uint64_t key;			/**< key of the mesh and its parameters */
+	uint64_t checksum;		/**< checksum of everything behind the
+						header */
+	long isPeriodic;		/**< periodic boundary condition flag */
+	long nNodes;			/**< number of nodes */
+	long nElems;			/**< number of inner elements */
+	long nTrias;			/**< number of triangles */
+	long nQuads;			/**< number of quadrangles */
+	long nElemsTotal;		/**< number of inner and ghost elements */
+	long nSidesTotal;		/**< number of sides in the side block */
+	long nSides;			/**< number of sides in the side list */
+	long nInnerSides;		/**< number of non BC sides */
+	long nBCsideList;		/**< length of the BC side list, including
+						the periodic sides */
+	long firstElem;			/**< index of the first element */
+	long firstSide;			/**< index of the first side */
+	double totalArea_q;		/**< inverse of the global area */
+	double xMin;			/**< minimum x-direction extension */
+	double xMax;			/**< maximum x-direction extension */
+	double yMin;			/**< minimum y-direction extension */
+	double yMax;			/**< maximum y-direction extension */
+};
+
+/**
+ * \brief Element as stored in the cache, pointers are replaced by indices
+ */
+struct cacheElem_t {
+	long id;			/**< element ID */
+	long fileId;			/**< element ID in the mesh file */
+	long firstSide;			/**< index of the first side */
+	long next;			/**< index of the next element */
+	long node[4];			/**< indices of the nodes */
+	int elemType;			/**< element type */
+	int domain;			/**< flow domain number */
+	long nGP;			/**< number of Gaussian integration points */
+	double bary[NDIM];		/**< barycenter */
+	double sx;			/**< cell extension in x-direction */
+	double sy;			/**< cell extension in y-direction */
+	double area;			/**< area of the element */
+	double areaq;			/**< inverse of element area */
+	double xGP[5][NDIM];		/**< Gaussian points */
+	double wGP[5];			/**< Gaussian weights */
+};
+
+/**
+ * \brief Side as stored in the cache, pointers are replaced by indices
+ */
+struct cacheSide_t {
+	long BC;			/**< BC code (100 * type + ID) or -1 */
+	long connection;		/**< index of the neighbor side */
+	long nextElemSide;		/**< index of the next side of the element */
+	long next;			/**< index of the next side in the list */
+	long elem;			/**< index of the element */
+	long node[2];			/**< indices of the nodes */
+	double baryBaryVec[NDIM];	/**< vector between the barycenters */
+	double baryBaryDist;		/**< length of `baryBaryVec` */
+};
+
+/**
+ * \brief FNV-1a hash, processing eight bytes per step
+ *
+ * Consecutive calls give the same hash as a single call over the joined
+ * data, as long as all but the last size are multiples of eight.
+ *
+ * \param[in] data Pointer to the data
+ * \param[in] size Size of the data in bytes
+ * \param[in] hash Hash of the preceding data, `FNV_OFFSET` to start
+ * \return Hash including the data
+ */
+uint64_t cacheHash(const void *data, size_t size, uint64_t hash)
+{
+	const unsigned char *p = data;
+	size_t nWords = size / sizeof(uint64_t);
+	for (size_t i = 0; i < nWords; ++i) {
+		uint64_t word;
+		memcpy(&word, p + i * sizeof(uint64_t), sizeof(uint64_t));
+		hash ^= word;
+		hash *= FNV_PRIME;
+	}
+	for (size_t i = nWords * sizeof(uint64_t); i < size; ++i) {
+		hash ^= p[i];
+		hash *= FNV_PRIME;
+	}
+	return hash;
+}
+
+/**
+ * \brief Compute the key of the mesh from the mesh file or the cartesian
+ *	mesh parameters, the renumbering and the boundary conditions
+ * \return The key
+ */
+uint64_t meshCacheKey(void)
+{
+	uint64_t key = FNV_OFFSET;
+	long version = MESH_CACHE_VERSION;
+	key = cacheHash(&version, sizeof(long), key);
+	key = cacheHash(&meshType, sizeof(int), key);
+	key = cacheHash(&meshRenumbering, sizeof(int), key);
+
+	switch (meshType) {
+	case CARTESIAN:
+		key = cacheHash(&cartMesh.iMax, sizeof(int), key);
+		key = cacheHash(&cartMesh.jMax, sizeof(int), key);
+		for (int iSide = 0; iSide < 2 * NDIM; ++iSide) {
+			key = cacheHash(&cartMesh.nBC[iSide], sizeof(int), key);
+			for (int i = 0; i < cartMesh.nBC[iSide]; ++i) {
+				key = cacheHash(&cartMesh.BCtype[iSide][i],
+						sizeof(int), key);
+				key = cacheHash(cartMesh.BCrange[iSide][i],
+						2 * sizeof(int), key);
+			}
+		}
+		key = cacheHash(&xMin, sizeof(double), key);
+		key = cacheHash(&xMax, sizeof(double), key);
+		key = cacheHash(&yMin, sizeof(double), key);
+		key = cacheHash(&yMax, sizeof(double), key);
+		break;
+	case UNSTRUCTURED: {
+		int fd = open(strMeshFile, O_RDONLY);
+		if (fd < 0) {
+			printf("| ERROR: Could not find Mesh File '%s'\n", strMeshFile);
+			exit(1);
+		}
+
+		struct stat fileStat;
+		if (fstat(fd, &fileStat) || (fileStat.st_size == 0)) {
+			printf("| ERROR: Could not read Mesh File '%s'\n", strMeshFile);
+			exit(1);
+		}
+
+		size_t size = fileStat.st_size;
+		char *data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (data == MAP_FAILED) {
+			printf("| ERROR: Could not map Mesh File '%s'\n", strMeshFile);
+			exit(1);
+		}
+		close(fd);
+
+		key = cacheHash(data, size, key);
+		munmap(data, size);
+		break;
+	}
+	}
+
+	/* the boundary conditions decide about ghost cells and periodic
+	 * connections */
+	boundary_t *aBC = firstBC;
+	while (aBC) {
+		key = cacheHash(&aBC->BCtype, sizeof(int), key);
+		key = cacheHash(&aBC->BCid, sizeof(int), key);
+		if (aBC->BCtype == PERIODIC) {
+			key = cacheHash(aBC->connection, NDIM * sizeof(double), key);
+		}
+		aBC = aBC->next;
+	}
+
+	return key;
+}
+
+/**
+ * \brief Write data to the cache file and add it to the checksum
+ * \param[in] file Cache file
+ * \param[in] data Pointer to the data
+ * \param[in] size Size of the data in bytes
+ * \param[in,out] checksum Checksum of the written data
+ * \return True if the data was written
+ */
+bool cacheWrite(FILE *file, const void *data, size_t size, uint64_t *checksum)
+{
+	*checksum = cacheHash(data, size, *checksum);
+	return (fwrite(data, 1, size, file) == size);
+}
+
+/**
+ * \brief Write the processed mesh into the cache file
+ *
+ * The file is written under a temporary name and renamed at the end, so
+ * that an interrupted run does not leave a broken cache.
+ *
+ * \param[in] fileName Name of the cache file
+ * \param[in] key Key of the mesh
+ */
+void writeMeshCache(char fileName[STRLEN], uint64_t key)
+{
+	char tmpName[STRLEN + 4];
+	strcat(strcpy(tmpName, fileName), ".tmp");
+
+	FILE *file = fopen(tmpName, "wb");
+	if (!file) {
+		printf("| WARNING: Could not write Mesh Cache '%s'\n", fileName);
+		return;
+	}
+
+	long nElemsTotal = elemData.nElems;
+	long nSidesTotal = sideData.nSides;
+
+	meshCacheHeader_t header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, "CCFDMESH", 8);
+	header.version = MESH_CACHE_VERSION;
+	header.key = key;
+	header.isPeriodic = isPeriodic;
+	header.nNodes = nNodes;
+	header.nElems = nElems;
+	header.nTrias = nTrias;
+	header.nQuads = nQuads;
+	header.nElemsTotal = nElemsTotal;
+	header.nSidesTotal = nSidesTotal;
+	header.nSides = nSides;
+	header.nInnerSides = nInnerSides;
+	header.firstElem = (firstElem ? firstElem - elemBlock : -1);
+	header.firstSide = (firstSide ? firstSide - sideBlock : -1);
+	header.totalArea_q = totalArea_q;
+	header.xMin = xMin;
+	header.xMax = xMax;
+	header.yMin = yMin;
+	header.yMax = yMax;
+
+	header.nBCsideList = 0;
+	sidePtr_t *aBCside = firstBCside;
+	while (aBCside) {
+		header.nBCsideList++;
+		aBCside = aBCside->next;
+	}
+
+	/* the header is written again with the checksum at the end */
+	bool isWritten = (fwrite(&header, sizeof(header), 1, file) == 1);
+	uint64_t checksum = FNV_OFFSET;
+
+	/* nodes, their index is the node ID */
+	node_t *aNode = firstNode;
+	while (aNode && isWritten) {
+		isWritten = cacheWrite(file, aNode->x, sizeof(double[NDIM]),
+				&checksum);
+		aNode = aNode->next;
+	}
+
+	/* elements */
+	for (long iElem = 0; (iElem < nElemsTotal) && isWritten; ++iElem) {
+		elem_t *aElem = &elemBlock[iElem];
+
+		cacheElem_t cElem;
+		memset(&cElem, 0, sizeof(cElem));
+		cElem.id = aElem->id;
+		cElem.fileId = aElem->fileId;
+		cElem.firstSide = (aElem->firstSide ?
+				aElem->firstSide - sideBlock : -1);
+		cElem.next = (aElem->next ? aElem->next - elemBlock : -1);
+		for (int iNode = 0; iNode < 4; ++iNode) {
+			cElem.node[iNode] = ((iNode < aElem->elemType) ?
+					aElem->node[iNode]->id : -1);
+		}
+		cElem.elemType = aElem->elemType;
+		cElem.domain = aElem->domain;
+		cElem.nGP = aElem->nGP;
+		cElem.bary[X] = aElem->bary[X];
+		cElem.bary[Y] = aElem->bary[Y];
+		cElem.sx = aElem->sx;
+		cElem.sy = aElem->sy;
+		cElem.area = aElem->area;
+		cElem.areaq = aElem->areaq;
+		for (int iGP = 0; iGP < aElem->nGP; ++iGP) {
+			cElem.xGP[iGP][X] = aElem->xGP[iGP][X];
+			cElem.xGP[iGP][Y] = aElem->xGP[iGP][Y];
+			cElem.wGP[iGP] = aElem->wGP[iGP];
+		}
+
+		isWritten = cacheWrite(file, &cElem, sizeof(cElem), &checksum);
+	}
+
+	/* sides */
+	for (long iSide = 0; (iSide < nSidesTotal) && isWritten; ++iSide) {
+		side_t *aSide = &sideBlock[iSide];
+
+		cacheSide_t cSide;
+		memset(&cSide, 0, sizeof(cSide));
+		cSide.BC = (aSide->BC ?
+				100 * aSide->BC->BCtype + aSide->BC->BCid : -1);
+		cSide.connection = (aSide->connection ?
+				aSide->connection - sideBlock : -1);
+		cSide.nextElemSide = (aSide->nextElemSide ?
+				aSide->nextElemSide - sideBlock : -1);
+		cSide.next = (aSide->next ? aSide->next - sideBlock : -1);
+		cSide.elem = (aSide->elem ? aSide->elem - elemBlock : -1);
+		cSide.node[0] = (aSide->node[0] ? aSide->node[0]->id : -1);
+		cSide.node[1] = (aSide->node[1] ? aSide->node[1]->id : -1);
+		cSide.baryBaryVec[X] = aSide->baryBaryVec[X];
+		cSide.baryBaryVec[Y] = aSide->baryBaryVec[Y];
+		cSide.baryBaryDist = aSide->baryBaryDist;
+
+		isWritten = cacheWrite(file, &cSide, sizeof(cSide), &checksum);
+	}
+
+	/* side geometry and reconstruction weights */
+	isWritten = isWritten &&
+		cacheWrite(file, sideData.n, nSidesTotal * sizeof(double[NDIM]),
+				&checksum) &&
+		cacheWrite(file, sideData.len, nSidesTotal * sizeof(double),
+				&checksum) &&
+		cacheWrite(file, sideData.GP, nSidesTotal * sizeof(double[NDIM]),
+				&checksum) &&
+		cacheWrite(file, sideData.w, nSidesTotal * sizeof(double[NDIM]),
+				&checksum);
+
+	/* BC side list */
+	aBCside = firstBCside;
+	while (aBCside && isWritten) {
+		long iSide = aBCside->side - sideBlock;
+		isWritten = cacheWrite(file, &iSide, sizeof(long), &checksum);
+		aBCside = aBCside->next;
+	}
+
+	header.checksum = checksum;
+	isWritten = isWritten && !fseek(file, 0, SEEK_SET) &&
+		(fwrite(&header, sizeof(header), 1, file) == 1);
+
+	if (fclose(file) || !isWritten || rename(tmpName, fileName)) {
+		printf("| WARNING: Could not write Mesh Cache '%s'\n", fileName);
+		remove(tmpName);
+		return;
+	}
+
+	printf("| Mesh Cache written to '%s'\n", fileName);
+}
+
+/**
+ * \brief Restore the mesh from the cache file
+ * \param[in] fileName Name of the cache file
+ * \param[in] key Key of the current mesh
+ * \return True if the mesh was restored, false if there is no valid cache
+ *	for the key
+ */
+bool readMeshCache(char fileName[STRLEN], uint64_t key)
+{
+	int fd = open(fileName, O_RDONLY);
+	if (fd < 0) {
+		return false;
+	}
+
+	struct stat fileStat;
+	if (fstat(fd, &fileStat) ||
+	    ((size_t)fileStat.st_size < sizeof(meshCacheHeader_t))) {
+		close(fd);
+		return false;
+	}
+
+	size_t size = fileStat.st_size;
+	char *data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED) {
+		return false;
+	}
+
+	/* check the header and the checksum */
+	const meshCacheHeader_t *header = (const meshCacheHeader_t *)data;
+	bool isValid = !memcmp(header->magic, "CCFDMESH", 8) &&
+		(header->version == MESH_CACHE_VERSION) &&
+		(header->key == key) && (header->nNodes >= 0) &&
+		(header->nElemsTotal >= 0) && (header->nSidesTotal >= 0) &&
+		(header->nBCsideList >= 0);
+
+	size_t nodeSize = 0, elemSize = 0, sideSize = 0, sideDataSize = 0;
+	if (isValid) {
+		nodeSize = header->nNodes * sizeof(double[NDIM]);
+		elemSize = header->nElemsTotal * sizeof(cacheElem_t);
+		sideSize = header->nSidesTotal * sizeof(cacheSide_t);
+		sideDataSize = header->nSidesTotal *
+			(3 * sizeof(double[NDIM]) + sizeof(double));
+		isValid = (size == sizeof(meshCacheHeader_t) + nodeSize +
+				elemSize + sideSize + sideDataSize +
+				header->nBCsideList * sizeof(long));
+	}
+
+	if (isValid) {
+		isValid = (header->checksum ==
+				cacheHash(data + sizeof(meshCacheHeader_t),
+					size - sizeof(meshCacheHeader_t),
+					FNV_OFFSET));
+	}
+
+	if (!isValid) {
+		printf("| Mesh Cache '%s' is outdated\n", fileName);
+		munmap(data, size);
+		return false;
+	}
+
+	const char *p = data + sizeof(meshCacheHeader_t);
+	const double (*cacheNode)[NDIM] = (const double (*)[NDIM])p;
+	const cacheElem_t *cacheElem = (const cacheElem_t *)(p += nodeSize);
+	const cacheSide_t *cacheSide = (const cacheSide_t *)(p += elemSize);
+	const double (*cacheN)[NDIM] = (const double (*)[NDIM])(p += sideSize);
+	const double *cacheLen = (const double *)
+		(p += header->nSidesTotal * sizeof(double[NDIM]));
+	const double (*cacheGP)[NDIM] = (const double (*)[NDIM])
+		(p += header->nSidesTotal * sizeof(double));
+	const double (*cacheW)[NDIM] = (const double (*)[NDIM])
+		(p += header->nSidesTotal * sizeof(double[NDIM]));
+	const long *cacheBCside = (const long *)
+		(p += header->nSidesTotal * sizeof(double[NDIM]));
+
+	/* global mesh information */
+	nNodes = header->nNodes;
+	nElems = header->nElems;
+	nTrias = header->nTrias;
+	nQuads = header->nQuads;
+	nSides = header->nSides;
+	nInnerSides = header->nInnerSides;
+	nBCsides = header->nBCsideList;
+	isPeriodic = header->isPeriodic;
+	totalArea_q = header->totalArea_q;
+	xMin = header->xMin;
+	xMax = header->xMax;
+	yMin = header->yMin;
+	yMax = header->yMax;
+
+	long nElemsTotal = header->nElemsTotal;
+	long nSidesTotal = header->nSidesTotal;
+
+	createStateData(nElemsTotal, nSidesTotal);
+
+	elemBlock = calloc(nElemsTotal, sizeof(elem_t));
+	sideBlock = calloc(nSidesTotal, sizeof(side_t));
+	if (!elemBlock || !sideBlock) {
+		printf("| ERROR: could not allocate elements and sides\n");
+		exit(1);
+	}
+
+	arenaInit(&meshArena, nNodes * sizeof(node_t)
+			+ nBCsides * sizeof(sidePtr_t) + nElems * 256);
+
+	/* nodes */
+	node_t *nodeBlock = arenaAlloc(&meshArena, nNodes * sizeof(node_t));
+	for (long iNode = 0; iNode < nNodes; ++iNode) {
+		nodeBlock[iNode].id = iNode;
+		nodeBlock[iNode].x[X] = cacheNode[iNode][X];
+		nodeBlock[iNode].x[Y] = cacheNode[iNode][Y];
+		nodeBlock[iNode].next = ((iNode + 1 < nNodes) ?
+				&nodeBlock[iNode + 1] : NULL);
+	}
+	firstNode = ((nNodes > 0) ? nodeBlock : NULL);
+
+	/* elements */
+	for (long iElem = 0; iElem < nElemsTotal; ++iElem) {
+		const cacheElem_t *cElem = &cacheElem[iElem];
+		elem_t *aElem = &elemBlock[iElem];
+
+		aElem->elemType = cElem->elemType;
+		aElem->id = cElem->id;
+		aElem->fileId = cElem->fileId;
+		aElem->domain = cElem->domain;
+		aElem->bary[X] = cElem->bary[X];
+		aElem->bary[Y] = cElem->bary[Y];
+		aElem->sx = cElem->sx;
+		aElem->sy = cElem->sy;
+		aElem->area = cElem->area;
+		aElem->areaq = cElem->areaq;
+		linkElemData(aElem, iElem);
+
+		aElem->firstSide = ((cElem->firstSide >= 0) ?
+				&sideBlock[cElem->firstSide] : NULL);
+		aElem->next = ((cElem->next >= 0) ?
+				&elemBlock[cElem->next] : NULL);
+
+		if (aElem->elemType > 0) {
+			aElem->node = arenaAlloc(&meshArena,
+					aElem->elemType * sizeof(node_t *));
+			for (int iNode = 0; iNode < aElem->elemType; ++iNode) {
+				aElem->node[iNode] = &nodeBlock[cElem->node[iNode]];
+			}
+		}
+
+		aElem->nGP = cElem->nGP;
+		if (aElem->nGP > 0) {
+			aElem->wGP = arenaAlloc(&meshArena,
+					aElem->nGP * sizeof(double));
+			aElem->xGP = arena2DdblArray(&meshArena, aElem->nGP, NDIM);
+			for (int iGP = 0; iGP < aElem->nGP; ++iGP) {
+				aElem->xGP[iGP][X] = cElem->xGP[iGP][X];
+				aElem->xGP[iGP][Y] = cElem->xGP[iGP][Y];
+				aElem->wGP[iGP] = cElem->wGP[iGP];
+			}
+		}
+	}
+	firstElem = ((header->firstElem >= 0) ?
+			&elemBlock[header->firstElem] : NULL);
+
+	/* sides */
+	for (long iSide = 0; iSide < nSidesTotal; ++iSide) {
+		const cacheSide_t *cSide = &cacheSide[iSide];
+		side_t *aSide = &sideBlock[iSide];
+
+		aSide->id = iSide;
+		linkSideData(aSide);
+
+		aSide->BC = NULL;
+		if (cSide->BC >= 0) {
+			boundary_t *aBC = firstBC;
+			while (aBC) {
+				if (100 * aBC->BCtype + aBC->BCid == cSide->BC) {
+					aSide->BC = aBC;
+					break;
+				}
+				aBC = aBC->next;
+			}
+			if (!aBC) {
+				printf("| ERROR: BC %ld from Mesh Cache not defined in Parameter File\n",
+						cSide->BC);
+				exit(1);
+			}
+		}
+
+		aSide->connection = ((cSide->connection >= 0) ?
+				&sideBlock[cSide->connection] : NULL);
+		aSide->nextElemSide = ((cSide->nextElemSide >= 0) ?
+				&sideBlock[cSide->nextElemSide] : NULL);
+		aSide->next = ((cSide->next >= 0) ?
+				&sideBlock[cSide->next] : NULL);
+		aSide->elem = ((cSide->elem >= 0) ?
+				&elemBlock[cSide->elem] : NULL);
+		aSide->node[0] = ((cSide->node[0] >= 0) ?
+				&nodeBlock[cSide->node[0]] : NULL);
+		aSide->node[1] = ((cSide->node[1] >= 0) ?
+				&nodeBlock[cSide->node[1]] : NULL);
+		aSide->baryBaryVec[X] = cSide->baryBaryVec[X];
+		aSide->baryBaryVec[Y] = cSide->baryBaryVec[Y];
+		aSide->baryBaryDist = cSide->baryBaryDist;
+	}
+	firstSide = ((header->firstSide >= 0) ?
+			&sideBlock[header->firstSide] : NULL);
+
+	memcpy(sideData.n, cacheN, nSidesTotal * sizeof(double[NDIM]));
+	memcpy(sideData.len, cacheLen, nSidesTotal * sizeof(double));
+	memcpy(sideData.GP, cacheGP, nSidesTotal * sizeof(double[NDIM]));
+	memcpy(sideData.w, cacheW, nSidesTotal * sizeof(double[NDIM]));
+
+	/* BC side list, in the original order */
+	firstBCside = NULL;
+	for (long i = header->nBCsideList - 1; i >= 0; --i) {
+		sidePtr_t *aBCside = arenaAlloc(&meshArena, sizeof(sidePtr_t));
+		aBCside->side = &sideBlock[cacheBCside[i]];
+		aBCside->next = firstBCside;
+		firstBCside = aBCside;
+	}
+
+	munmap(data, size);
+
+	printf("| Mesh read from Mesh Cache '%s'\n", fileName);
+	printf("| %7ld Nodes, %ld Elements, %ld Sides\n", nNodes, nElems, nSides);
+
+	createElemSideLists();
+	return true;
+}
@@ -0,0 +1,19 @@
+/** \file
+ *
+ * \author hhh
+ * \date Sun 18 Oct 2026 02:27:15 PM CEST
+ */
+
+#ifndef MESHCACHE_H
+#define MESHCACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "main.h"
+
+uint64_t meshCacheKey(void);
+bool readMeshCache(char fileName[STRLEN], uint64_t key);
+void writeMeshCache(char fileName[STRLEN], uint64_t key);
+
+#endif
@@ -0,0 +1,849 @@
+/** \file
+ *
+ * \brief Agglomeration multigrid with full approximation storage (FAS), for
+ *	stationary computations
+ *
+ * The coarse levels are built by agglomerating the cells of the next finer
+ * level. The faces between two coarse cells are merged into one coarse face
+ * with the summed normal vector. The coarse operator is of first order: the
+ * convective flux of the selected flux function is evaluated once for every
+ * coarse face, the viscous fluxes are left out. The time step of the fine
+ * level is the pre-smoother of the finest level. The coarse levels are
+ * smoothed by the Runge-Kutta scheme of the time discretization with local
+ * time steps.
+ *
+ * \author hhh
+ * \date Sun 18 Oct 2026 06:41:09 PM CEST
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+#include "main.h"
+#include "multigrid.h"
+#include "readInTools.h"
+#include "mesh.h"
+#include "equation.h"
+#include "equationOfState.h"
+#include "boundary.h"
+#include "fluxCalculation.h"
+#include "finiteVolume.h"
+#include "timeDiscretization.h"
+
+#define MG_BC_ALIGNMENT 0.9	/**< minimum cosine of the angle between two
+					boundary faces that are merged */
+
+typedef struct mgFace_t mgFace_t;
+typedef struct mgLevel_t mgLevel_t;
+
+/**
+ * \brief Face of a multigrid level
+ */
+struct mgFace_t {
+	long cell[2];			/**< cells on both sides of the face, the
+					second one is -1 at a boundary */
+	boundary_t *BC;			/**< boundary condition, NULL for inner
+					faces */
+	side_t *gSide;			/**< ghost side for the boundary
+					condition, NULL for inner faces */
+	double nLen[NDIM];		/**< normal vector from the first to the
+					second cell, times the length */
+	double n[NDIM];			/**< unit normal vector */
+	double len;			/**< length of the face */
+	double x[NDIM];			/**< center of the face */
+	double xWeight;			/**< summed length of the merged faces,
+					weight of the center */
+};
+
+/**
+ * \brief Cells, faces and states of a multigrid level
+ *
+ * The finest level refers to the element states of the mesh, its faces are
+ * only used to build the first coarse level.
+ */
+struct mgLevel_t {
+	long nCells;			/**< number of cells */
+	long nFaces;			/**< number of faces */
+	long *parent;			/**< cell of the next coarser level that
+					contains the cell */
+	mgFace_t *face;			/**< faces */
+	side_t *BCsides;		/**< side pairs of the boundary faces, for
+					the boundary conditions */
+	long *cellFaceStart;		/**< index of the first face of every cell
+					in `cellFace`, `nCells + 1` entries */
+	long *cellFace;			/**< faces of every cell */
+	double *area;			/**< area of every cell */
+	double (*cVar)[NVAR];		/**< conservative variables */
+	double (*pVar)[NVAR];		/**< primitive variables */
+	double (*cVarRestr)[NVAR];	/**< restricted conservative variables,
+					reference for the correction */
+	double (*cVarStage)[NVAR];	/**< conservative variables at initial
+					Runge-Kutta stage */
+	double (*res)[NVAR];		/**< integrated residual */
+	double (*forcing)[NVAR];	/**< FAS forcing term */
+	double (*faceFlux)[NVAR];	/**< integrated flux over every face */
+	double *dt;			/**< local time step */
+};
+
+/* extern variables */
+int nMGlevels;				/**< number of multigrid levels, 1 for
+					single grid */
+int mgCycle;				/**< cycle type: 1 = V-cycle, 2 = W-cycle */
+double mgWork;				/**< work of the coarse levels, in
+					residual evaluations of the finest level */
+
+/* local variables */
+mgLevel_t *mgLevel;			/**< the multigrid levels, finest first */
+int nPreSmooth;				/**< Runge-Kutta steps on a coarse level
+					before the next coarser level */
+int nPostSmooth;			/**< Runge-Kutta steps on a coarse level
+					after the correction */
+double mgCFL;				/**< CFL number of the coarse levels */
+
+/**
+ * \brief Allocate an array, aborting if the memory is not available
+ * \param[in] size Size of the array in bytes
+ * \return Pointer to the zero initialized array
+ */
+void *mgAlloc(size_t size)
+{
+	void *ptr = calloc(1, (size > 0 ? size : 1));
+	if (!ptr) {
+		printf("| ERROR: could not allocate multigrid level\n");
+		exit(1);
+	}
+	return ptr;
+}
+
+/**
+ * \brief Set the unit normal vectors and lengths of the faces, and create the
+ *	face lists of the cells
+ * \param[in,out] lvl The multigrid level
+ */
+void mgFaceLists(mgLevel_t *lvl)
+{
+	long nBCfaces = 0;
+	lvl->cellFaceStart = mgAlloc((lvl->nCells + 1) * sizeof(long));
+	for (long iFace = 0; iFace < lvl->nFaces; ++iFace) {
+		mgFace_t *aFace = &lvl->face[iFace];
+		aFace->len = sqrt(aFace->nLen[X] * aFace->nLen[X]
+				+ aFace->nLen[Y] * aFace->nLen[Y]);
+		aFace->n[X] = aFace->nLen[X] / aFace->len;
+		aFace->n[Y] = aFace->nLen[Y] / aFace->len;
+
+		lvl->cellFaceStart[aFace->cell[0] + 1]++;
+		if (aFace->cell[1] >= 0) {
+			lvl->cellFaceStart[aFace->cell[1] + 1]++;
+		} else {
+			nBCfaces++;
+		}
+	}
+
+	for (long iCell = 0; iCell < lvl->nCells; ++iCell) {
+		lvl->cellFaceStart[iCell + 1] += lvl->cellFaceStart[iCell];
+	}
+
+	long *pos = mgAlloc(lvl->nCells * sizeof(long));
+	memcpy(pos, lvl->cellFaceStart, lvl->nCells * sizeof(long));
+	lvl->cellFace = mgAlloc(lvl->cellFaceStart[lvl->nCells] * sizeof(long));
+	for (long iFace = 0; iFace < lvl->nFaces; ++iFace) {
+		mgFace_t *aFace = &lvl->face[iFace];
+		lvl->cellFace[pos[aFace->cell[0]]++] = iFace;
+		if (aFace->cell[1] >= 0) {
+			lvl->cellFace[pos[aFace->cell[1]]++] = iFace;
+		}
+	}
+	free(pos);
+
+	/* the boundary conditions take a ghost side, connected to the inner
+	 * side with the normal vector */
+	lvl->BCsides = mgAlloc(2 * nBCfaces * sizeof(side_t));
+	nBCfaces = 0;
+	for (long iFace = 0; iFace < lvl->nFaces; ++iFace) {
+		mgFace_t *aFace = &lvl->face[iFace];
+		if (aFace->cell[1] >= 0) {
+			continue;
+		}
+
+		side_t *gSide = &lvl->BCsides[2 * nBCfaces];
+		side_t *aSide = &lvl->BCsides[2 * nBCfaces + 1];
+		gSide->BC = aFace->BC;
+		gSide->BCtype = aFace->BC->BCtype;
+		gSide->connection = aSide;
+		aSide->n = aFace->n;
+		aSide->connection = gSide;
+		aFace->gSide = gSide;
+		nBCfaces++;
+	}
+}
+
+/**
+ * \brief Create the finest level from the mesh
+ *
+ * The faces are oriented from the inner element to the ghost element at
+ * the boundaries.
+ */
+void mgFineLevel(void)
+{
+	mgLevel_t *lvl = &mgLevel[0];
+	lvl->nCells = nElems;
+	lvl->nFaces = nSides;
+	lvl->cVar = elemData.cVar;
+	lvl->pVar = elemData.pVar;
+	lvl->area = mgAlloc(nElems * sizeof(double));
+	lvl->res = mgAlloc(nElems * sizeof(double[NVAR]));
+	lvl->face = mgAlloc(nSides * sizeof(mgFace_t));
+
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		lvl->area[iElem] = elem[iElem]->area;
+	}
+
+	for (long iSide = 0; iSide < nSides; ++iSide) {
+		side_t *aSide = side[iSide];
+		side_t *bSide = aSide->connection;
+		if (aSide->elem - elemBlock >= nElems) {
+			aSide = bSide;
+			bSide = side[iSide];
+		}
+
+		mgFace_t *aFace = &lvl->face[iSide];
+		double *n = sideData.n[aSide->id];
+		double len = sideData.len[aSide->id];
+		aFace->cell[0] = aSide->elem - elemBlock;
+		aFace->nLen[X] = n[X] * len;
+		aFace->nLen[Y] = n[Y] * len;
+
+		long iElemR = bSide->elem - elemBlock;
+		if (iElemR >= nElems) {
+			aFace->cell[1] = -1;
+			aFace->BC = bSide->BC;
+			aFace->x[X] = aSide->elem->bary[X] + sideData.GP[aSide->id][X];
+			aFace->x[Y] = aSide->elem->bary[Y] + sideData.GP[aSide->id][Y];
+		} else {
+			aFace->cell[1] = iElemR;
+		}
+	}
+}
+
+/**
+ * \brief Match the groups of cells of a level pairwise
+ *
+ * Every group that is not yet matched is paired with the unmatched neighbor
+ * group that shares the longest faces with it. The groups that are left
+ * join the neighbor group with the longest shared faces.
+ *
+ * \param[in] fine The level
+ * \param[in,out] group Group of every cell, replaced by the matched group
+ * \param[in] nGroups Number of groups
+ * \return The number of matched groups
+ */
+long mgMatchGroups(mgLevel_t *fine, long *group, long nGroups)
+{
+	long nCells = fine->nCells;
+
+	/* cells of every group */
+	long *groupStart = mgAlloc((nGroups + 1) * sizeof(long));
+	long *groupCell = mgAlloc(nCells * sizeof(long));
+	for (long iCell = 0; iCell < nCells; ++iCell) {
+		groupStart[group[iCell] + 1]++;
+	}
+	for (long iGroup = 0; iGroup < nGroups; ++iGroup) {
+		groupStart[iGroup + 1] += groupStart[iGroup];
+	}
+	long *pos = mgAlloc(nGroups * sizeof(long));
+	memcpy(pos, groupStart, nGroups * sizeof(long));
+	for (long iCell = 0; iCell < nCells; ++iCell) {
+		groupCell[pos[group[iCell]]++] = iCell;
+	}
+	free(pos);
+
+	/* neighbor groups with the length of the shared faces */
+	long *nbGroup = mgAlloc(fine->cellFaceStart[nCells] * sizeof(long));
+	double *nbLen = mgAlloc(fine->cellFaceStart[nCells] * sizeof(double));
+	long *match = mgAlloc(nGroups * sizeof(long));
+	for (long iGroup = 0; iGroup < nGroups; ++iGroup) {
+		match[iGroup] = -1;
+	}
+
+	long nMatched = 0;
+	for (int iPass = 0; iPass < 2; ++iPass) {
+		for (long iGroup = 0; iGroup < nGroups; ++iGroup) {
+			if (match[iGroup] >= 0) {
+				continue;
+			}
+
+			int nNb = 0;
+			for (long k = groupStart[iGroup]; k < groupStart[iGroup + 1]; ++k) {
+				long iCell = groupCell[k];
+				for (long l = fine->cellFaceStart[iCell]; l < fine->cellFaceStart[iCell + 1]; ++l) {
+					mgFace_t *aFace = &fine->face[fine->cellFace[l]];
+					long jCell = (aFace->cell[0] == iCell ? aFace->cell[1] : aFace->cell[0]);
+					if ((jCell < 0) || (group[jCell] == iGroup)) {
+						continue;
+					}
+
+					int iNb = 0;
+					while ((iNb < nNb) && (nbGroup[iNb] != group[jCell])) {
+						iNb++;
+					}
+					if (iNb == nNb) {
+						nbGroup[nNb] = group[jCell];
+						nbLen[nNb++] = 0.0;
+					}
+					nbLen[iNb] += aFace->len;
+				}
+			}
+
+			/* first pass: pair with an unmatched group, second pass:
+			 * join a matched group */
+			long iBest = -1;
+			double lenBest = 0.0;
+			for (int iNb = 0; iNb < nNb; ++iNb) {
+				bool isMatched = (match[nbGroup[iNb]] >= 0);
+				if ((isMatched == (iPass == 1)) && (nbLen[iNb] > lenBest)) {
+					iBest = nbGroup[iNb];
+					lenBest = nbLen[iNb];
+				}
+			}
+
+			if (iBest >= 0) {
+				if (iPass == 0) {
+					match[iBest] = nMatched;
+					match[iGroup] = nMatched++;
+				} else {
+					match[iGroup] = match[iBest];
+				}
+			} else if (iPass == 1) {
+				match[iGroup] = nMatched++;
+			}
+		}
+	}
+
+	for (long iCell = 0; iCell < nCells; ++iCell) {
+		group[iCell] = match[group[iCell]];
+	}
+
+	free(groupStart);
+	free(groupCell);
+	free(nbGroup);
+	free(nbLen);
+	free(match);
+
+	return nMatched;
+}
+
+/**
+ * \brief Agglomerate the cells of a level
+ *
+ * The cells are matched pairwise twice, which gives coarse cells of about
+ * four cells, both for triangles and quadrilaterals. Pairing by the longest
+ * shared faces keeps the coarse cells compact on stretched meshes.
+ *
+ * \param[in,out] fine The level to be agglomerated, `parent` is set
+ * \return The number of coarse cells
+ */
+long mgAgglomerate(mgLevel_t *fine)
+{
+	long *parent = mgAlloc(fine->nCells * sizeof(long));
+	for (long iCell = 0; iCell < fine->nCells; ++iCell) {
+		parent[iCell] = iCell;
+	}
+	fine->parent = parent;
+
+	long nCoarse = mgMatchGroups(fine, parent, fine->nCells);
+	return mgMatchGroups(fine, parent, nCoarse);
+}
+
+/**
+ * \brief Compare two faces by their cells and boundary condition, for qsort
+ * \param[in] a First face
+ * \param[in] b Second face
+ * \return Negative, zero or positive, as for qsort
+ */
+int mgCompareFaces(const void *a, const void *b)
+{
+	const mgFace_t *faceA = a, *faceB = b;
+	for (int i = 0; i < 2; ++i) {
+		if (faceA->cell[i] != faceB->cell[i]) {
+			return (faceA->cell[i] < faceB->cell[i] ? -1 : 1);
+		}
+	}
+	if (faceA->BC != faceB->BC) {
+		return ((uintptr_t)faceA->BC < (uintptr_t)faceB->BC ? -1 : 1);
+	}
+	return 0;
+}
+
+/**
+ * \brief Build the next coarser level by agglomeration
+ *
+ * The faces between two coarse cells are merged, their normal vectors are
+ * summed. Boundary faces of a coarse cell with the same boundary condition
+ * are only merged if their normal vectors are aligned, so that opposite
+ * sides of a thin body are kept apart.
+ *
+ * \param[in,out] fine The finer level
+ * \param[out] coarse The coarser level
+ */
+void mgCoarseLevel(mgLevel_t *fine, mgLevel_t *coarse)
+{
+	long nCells = mgAgglomerate(fine);
+	coarse->nCells = nCells;
+
+	/* coarse faces of all fine faces between different coarse cells,
+	 * ordered by their coarse cells */
+	mgFace_t *faces = mgAlloc(fine->nFaces * sizeof(mgFace_t));
+	long nFaces = 0;
+	for (long iFace = 0; iFace < fine->nFaces; ++iFace) {
+		mgFace_t *fFace = &fine->face[iFace];
+		long a = fine->parent[fFace->cell[0]];
+		long b = (fFace->cell[1] >= 0 ? fine->parent[fFace->cell[1]] : -1);
+		if (a == b) {
+			continue;
+		}
+
+		mgFace_t *aFace = &faces[nFaces++];
+		*aFace = *fFace;
+		aFace->cell[0] = a;
+		aFace->cell[1] = b;
+		aFace->x[X] *= fFace->len;
+		aFace->x[Y] *= fFace->len;
+		aFace->xWeight = fFace->len;
+		if ((b >= 0) && (b < a)) {
+			aFace->cell[0] = b;
+			aFace->cell[1] = a;
+			aFace->nLen[X] = - aFace->nLen[X];
+			aFace->nLen[Y] = - aFace->nLen[Y];
+		}
+	}
+	qsort(faces, nFaces, sizeof(mgFace_t), mgCompareFaces);
+
+	/* merge the faces */
+	coarse->face = mgAlloc(nFaces * sizeof(mgFace_t));
+	long nMerged = 0, groupStart = 0;
+	for (long iFace = 0; iFace < nFaces; ++iFace) {
+		mgFace_t *aFace = &faces[iFace];
+		if ((iFace == 0) || mgCompareFaces(aFace, &faces[iFace - 1])) {
+			groupStart = nMerged;
+		}
+
+		mgFace_t *mFace = NULL;
+		for (long k = groupStart; k < nMerged; ++k) {
+			mgFace_t *bFace = &coarse->face[k];
+			if (aFace->cell[1] >= 0) {
+				mFace = bFace;
+				break;
+			}
+
+			double dot = aFace->nLen[X] * bFace->nLen[X]
+				+ aFace->nLen[Y] * bFace->nLen[Y];
+			double lenA = sqrt(aFace->nLen[X] * aFace->nLen[X]
+					+ aFace->nLen[Y] * aFace->nLen[Y]);
+			double lenB = sqrt(bFace->nLen[X] * bFace->nLen[X]
+					+ bFace->nLen[Y] * bFace->nLen[Y]);
+			if (dot >= MG_BC_ALIGNMENT * lenA * lenB) {
+				mFace = bFace;
+				break;
+			}
+		}
+
+		if (mFace) {
+			mFace->nLen[X] += aFace->nLen[X];
+			mFace->nLen[Y] += aFace->nLen[Y];
+			mFace->x[X] += aFace->x[X];
+			mFace->x[Y] += aFace->x[Y];
+			mFace->xWeight += aFace->xWeight;
+		} else {
+			coarse->face[nMerged++] = *aFace;
+		}
+	}
+	free(faces);
+
+	coarse->nFaces = nMerged;
+	for (long iFace = 0; iFace < nMerged; ++iFace) {
+		mgFace_t *aFace = &coarse->face[iFace];
+		aFace->x[X] /= aFace->xWeight;
+		aFace->x[Y] /= aFace->xWeight;
+	}
+	mgFaceLists(coarse);
+
+	/* cell data */
+	coarse->area = mgAlloc(nCells * sizeof(double));
+	for (long iCell = 0; iCell < fine->nCells; ++iCell) {
+		coarse->area[fine->parent[iCell]] += fine->area[iCell];
+	}
+
+	coarse->cVar = mgAlloc(nCells * sizeof(double[NVAR]));
+	coarse->pVar = mgAlloc(nCells * sizeof(double[NVAR]));
+	coarse->cVarRestr = mgAlloc(nCells * sizeof(double[NVAR]));
+	coarse->cVarStage = mgAlloc(nCells * sizeof(double[NVAR]));
+	coarse->res = mgAlloc(nCells * sizeof(double[NVAR]));
+	coarse->forcing = mgAlloc(nCells * sizeof(double[NVAR]));
+	coarse->faceFlux = mgAlloc(coarse->nFaces * sizeof(double[NVAR]));
+	coarse->dt = mgAlloc(nCells * sizeof(double));
+}
+
+/**
+ * \brief Compute the integrated residual of a coarse level, without the
+ *	forcing term
+ *
+ * The fluxes are computed per face in batches, as on the finest level, and
+ * gathered by the cells.
+ *
+ * \param[in,out] lvl The coarse level
+ * \param[in] time Calculation time
+ */
+void mgResidual(mgLevel_t *lvl, double time)
+{
+	#pragma omp parallel for
+	for (long iStart = 0; iStart < lvl->nFaces; iStart += FLUX_BATCH) {
+		int nBatch = ((lvl->nFaces - iStart < FLUX_BATCH) ?
+				lvl->nFaces - iStart : FLUX_BATCH);
+
+		double pVarL[NVAR][FLUX_BATCH], pVarR[NVAR][FLUX_BATCH];
+		double fluxLoc[NVAR][FLUX_BATCH];
+		for (int i = 0; i < nBatch; ++i) {
+			mgFace_t *aFace = &lvl->face[iStart + i];
+			double *n = aFace->n;
+			double *pL = lvl->pVar[aFace->cell[0]];
+			double pGhost[NVAR];
+			double *pR = pGhost;
+			if (aFace->cell[1] >= 0) {
+				pR = lvl->pVar[aFace->cell[1]];
+			} else {
+				boundary(aFace->gSide, time, pL, pGhost, aFace->x);
+			}
+
+			pVarL[RHO][i] = pL[RHO];
+			pVarL[VX][i]  =   n[X] * pL[VX] + n[Y] * pL[VY];
+			pVarL[VY][i]  = - n[Y] * pL[VX] + n[X] * pL[VY];
+			pVarL[P][i]   = pL[P];
+
+			pVarR[RHO][i] = pR[RHO];
+			pVarR[VX][i]  =   n[X] * pR[VX] + n[Y] * pR[VY];
+			pVarR[VY][i]  = - n[Y] * pR[VX] + n[X] * pR[VY];
+			pVarR[P][i]   = pR[P];
+		}
+
+		fluxBatch(nBatch, pVarL, pVarR, fluxLoc);
+
+		/* rotate flux into global coordinate system and integrate */
+		for (int i = 0; i < nBatch; ++i) {
+			mgFace_t *aFace = &lvl->face[iStart + i];
+			double *n = aFace->n;
+			double *flux = lvl->faceFlux[iStart + i];
+			flux[RHO] = aFace->len * fluxLoc[RHO][i];
+			flux[MX]  = aFace->len * (n[X] * fluxLoc[MX][i] - n[Y] * fluxLoc[MY][i]);
+			flux[MY]  = aFace->len * (n[Y] * fluxLoc[MX][i] + n[X] * fluxLoc[MY][i]);
+			flux[E]   = aFace->len * fluxLoc[E][i];
+		}
+	}
+
+	#pragma omp parallel for
+	for (long iCell = 0; iCell < lvl->nCells; ++iCell) {
+		double *res = lvl->res[iCell];
+		res[RHO] = res[MX] = res[MY] = res[E] = 0.0;
+		for (long k = lvl->cellFaceStart[iCell]; k < lvl->cellFaceStart[iCell + 1]; ++k) {
+			long iFace = lvl->cellFace[k];
+			double *flux = lvl->faceFlux[iFace];
+			double sign = (lvl->face[iFace].cell[0] == iCell ? -1.0 : 1.0);
+			res[RHO] += sign * flux[RHO];
+			res[MX]  += sign * flux[MX];
+			res[MY]  += sign * flux[MY];
+			res[E]   += sign * flux[E];
+		}
+	}
+
+	mgWork += (double)lvl->nFaces / nSides;
+}
+
+/**
+ * \brief Compute the local time steps of a coarse level from the sum of the
+ *	convective spectral radii over the faces
+ * \param[in,out] lvl The coarse level
+ */
+void mgTimeStep(mgLevel_t *lvl)
+{
+	#pragma omp parallel for
+	for (long iCell = 0; iCell < lvl->nCells; ++iCell) {
+		double *pVar = lvl->pVar[iCell];
+		double a = sqrt(gam * pVar[P] / pVar[RHO]);
+		double sumSpectralRadii = 0.0;
+		for (long k = lvl->cellFaceStart[iCell]; k < lvl->cellFaceStart[iCell + 1]; ++k) {
+			mgFace_t *aFace = &lvl->face[lvl->cellFace[k]];
+			double v = aFace->n[X] * pVar[VX] + aFace->n[Y] * pVar[VY];
+			sumSpectralRadii += (fabs(v) + a) * aFace->len;
+		}
+		lvl->dt[iCell] = mgCFL * lvl->area[iCell] / (0.5 * sumSpectralRadii);
+	}
+}
+
+/**
+ * \brief Smooth a coarse level with one Runge-Kutta step
+ * \param[in,out] lvl The coarse level
+ * \param[in] time Calculation time
+ */
+void mgSmooth(mgLevel_t *lvl, double time)
+{
+	mgTimeStep(lvl);
+	memcpy(lvl->cVarStage, lvl->cVar, lvl->nCells * sizeof(double[NVAR]));
+
+	for (int iStage = 1; iStage <= nRKstages; ++iStage) {
+		mgResidual(lvl, time);
+
+		#pragma omp parallel for
+		for (long iCell = 0; iCell < lvl->nCells; ++iCell) {
+			double dtRK = RKcoeff[iStage] * lvl->dt[iCell] / lvl->area[iCell];
+			double *cVar = lvl->cVar[iCell];
+			double *cVarStage = lvl->cVarStage[iCell];
+			double *res = lvl->res[iCell];
+			double *forcing = lvl->forcing[iCell];
+
+			cVar[RHO] = cVarStage[RHO] + dtRK * (res[RHO] + forcing[RHO]);
+			cVar[MX]  = cVarStage[MX]  + dtRK * (res[MX]  + forcing[MX]);
+			cVar[MY]  = cVarStage[MY]  + dtRK * (res[MY]  + forcing[MY]);
+			cVar[E]   = cVarStage[E]   + dtRK * (res[E]   + forcing[E]);
+
+			consPrim(cVar, lvl->pVar[iCell]);
+		}
+	}
+}
+
+/**
+ * \brief Restrict the state and residual of a level to the next coarser level
+ *
+ * The state is restricted by volume averaging. The forcing term makes the
+ * coarse residual of the restricted state equal to the restricted fine
+ * residual.
+ *
+ * \param[in] iLevel The finer level
+ * \param[in] time Calculation time
+ */
+void mgRestrict(int iLevel, double time)
+{
+	mgLevel_t *fine = &mgLevel[iLevel];
+	mgLevel_t *coarse = &mgLevel[iLevel + 1];
+
+	/* residual of the finer level, including its forcing term */
+	if (iLevel == 0) {
+		fvTimeDerivative(time);
+		mgWork += 1.0;
+
+		#pragma omp parallel for
+		for (long iElem = 0; iElem < nElems; ++iElem) {
+			double *u_t = elemData.u_t[iElem];
+			double area = fine->area[iElem];
+			fine->res[iElem][RHO] = area * u_t[RHO];
+			fine->res[iElem][MX]  = area * u_t[MX];
+			fine->res[iElem][MY]  = area * u_t[MY];
+			fine->res[iElem][E]   = area * u_t[E];
+		}
+	} else {
+		mgResidual(fine, time);
+
+		#pragma omp parallel for
+		for (long iCell = 0; iCell < fine->nCells; ++iCell) {
+			fine->res[iCell][RHO] += fine->forcing[iCell][RHO];
+			fine->res[iCell][MX]  += fine->forcing[iCell][MX];
+			fine->res[iCell][MY]  += fine->forcing[iCell][MY];
+			fine->res[iCell][E]   += fine->forcing[iCell][E];
+		}
+	}
+
+	memset(coarse->cVar, 0, coarse->nCells * sizeof(double[NVAR]));
+	memset(coarse->forcing, 0, coarse->nCells * sizeof(double[NVAR]));
+	for (long iCell = 0; iCell < fine->nCells; ++iCell) {
+		long iCoarse = fine->parent[iCell];
+		double area = fine->area[iCell];
+		for (int iVar = 0; iVar < NVAR; ++iVar) {
+			coarse->cVar[iCoarse][iVar] += area * fine->cVar[iCell][iVar];
+			coarse->forcing[iCoarse][iVar] += fine->res[iCell][iVar];
+		}
+	}
+
+	#pragma omp parallel for
+	for (long iCell = 0; iCell < coarse->nCells; ++iCell) {
+		double areaq = 1.0 / coarse->area[iCell];
+		double *cVar = coarse->cVar[iCell];
+		cVar[RHO] *= areaq;
+		cVar[MX]  *= areaq;
+		cVar[MY]  *= areaq;
+		cVar[E]   *= areaq;
+
+		consPrim(cVar, coarse->pVar[iCell]);
+	}
+	memcpy(coarse->cVarRestr, coarse->cVar, coarse->nCells * sizeof(double[NVAR]));
+
+	mgResidual(coarse, time);
+
+	#pragma omp parallel for
+	for (long iCell = 0; iCell < coarse->nCells; ++iCell) {
+		coarse->forcing[iCell][RHO] -= coarse->res[iCell][RHO];
+		coarse->forcing[iCell][MX]  -= coarse->res[iCell][MX];
+		coarse->forcing[iCell][MY]  -= coarse->res[iCell][MY];
+		coarse->forcing[iCell][E]   -= coarse->res[iCell][E];
+	}
+}
+
+/**
+ * \brief Prolong the correction of a coarse level to the next finer level,
+ *	by injection
+ * \param[in] iLevel The finer level
+ */
+void mgProlong(int iLevel)
+{
+	mgLevel_t *fine = &mgLevel[iLevel];
+	mgLevel_t *coarse = &mgLevel[iLevel + 1];
+
+	#pragma omp parallel for
+	for (long iCell = 0; iCell < fine->nCells; ++iCell) {
+		long iCoarse = fine->parent[iCell];
+		double *cVar = fine->cVar[iCell];
+		double *cVarC = coarse->cVar[iCoarse];
+		double *cVarRestr = coarse->cVarRestr[iCoarse];
+
+		cVar[RHO] += cVarC[RHO] - cVarRestr[RHO];
+		cVar[MX]  += cVarC[MX]  - cVarRestr[MX];
+		cVar[MY]  += cVarC[MY]  - cVarRestr[MY];
+		cVar[E]   += cVarC[E]   - cVarRestr[E];
+
+		consPrim(cVar, fine->pVar[iCell]);
+	}
+}
+
+/**
+ * \brief Perform a multigrid cycle on a coarse level
+ *
+ * The level is smoothed, the next coarser level is visited once for a
+ * V-cycle or twice for a W-cycle, and its correction is prolonged.
+ *
+ * \param[in] iLevel The coarse level
+ * \param[in] time Calculation time
+ */
+void mgCycleLevel(int iLevel, double time)
+{
+	for (int i = 0; i < nPreSmooth; ++i) {
+		mgSmooth(&mgLevel[iLevel], time);
+	}
+
+	if (iLevel < nMGlevels - 1) {
+		mgRestrict(iLevel, time);
+		for (int iCycle = 0; iCycle < mgCycle; ++iCycle) {
+			mgCycleLevel(iLevel + 1, time);
+		}
+		mgProlong(iLevel);
+	}
+
+	for (int i = 0; i < nPostSmooth; ++i) {
+		mgSmooth(&mgLevel[iLevel], time);
+	}
+}
+
+/**
+ * \brief Correct the state of the finest level by a multigrid cycle on the
+ *	coarse levels, after the time step of the finest level
+ * \param[in] time Calculation time
+ */
+void multigridCorrection(double time)
+{
+	mgRestrict(0, time);
+	for (int iCycle = 0; iCycle < mgCycle; ++iCycle) {
+		mgCycleLevel(1, time);
+	}
+	mgProlong(0);
+}
+
+/**
+ * \brief Initialize the multigrid levels
+ */
+void initMultigrid(void)
+{
+	mgWork = 0.0;
+	nMGlevels = getInt("mgLevels", "1");
+	if (nMGlevels < 2) {
+		nMGlevels = 1;
+		return;
+	}
+
+	printf("\nInitialize Multigrid:\n");
+	if (!isStationary) {
+		printf("| ERROR: Multigrid is only available for stationary problems\n");
+		exit(1);
+	}
+	if (isLowStorageRK) {
+		printf("| ERROR: Multigrid needs the multistage RK coefficients\n");
+		exit(1);
+	}
+
+	mgCycle = getInt("mgCycle", "1");
+	switch (mgCycle) {
+	case 1:
+		printf("| Cycle: V\n");
+		break;
+	case 2:
+		printf("| Cycle: W\n");
+		break;
+	default:
+		printf("| ERROR: Multigrid cycle must be either 1 or 2\n");
+		exit(1);
+	}
+
+	nPreSmooth = getInt("mgPreSmooth", "1");
+	nPostSmooth = getInt("mgPostSmooth", "0");
+
+	char cflStr[STRLEN];
+	sprintf(cflStr, "%g", (isImplicit ? 1.0 : cfl));
+	mgCFL = getDbl("mgCFL", cflStr);
+
+	mgLevel = mgAlloc(nMGlevels * sizeof(mgLevel_t));
+	mgFineLevel();
+	mgFaceLists(&mgLevel[0]);
+	printf("| Level 0: %ld Cells, %ld Faces\n", mgLevel[0].nCells,
+			mgLevel[0].nFaces);
+
+	for (int iLevel = 1; iLevel < nMGlevels; ++iLevel) {
+		mgCoarseLevel(&mgLevel[iLevel - 1], &mgLevel[iLevel]);
+		printf("| Level %d: %ld Cells, %ld Faces\n", iLevel,
+				mgLevel[iLevel].nCells, mgLevel[iLevel].nFaces);
+
+		if (mgLevel[iLevel].nCells == 1) {
+			nMGlevels = iLevel + 1;
+			break;
+		}
+	}
+}
+
+/**
+ * \brief Free the multigrid levels
+ */
+void freeMultigrid(void)
+{
+	if (nMGlevels < 2) {
+		return;
+	}
+
+	for (int iLevel = 0; iLevel < nMGlevels; ++iLevel) {
+		mgLevel_t *lvl = &mgLevel[iLevel];
+		free(lvl->parent);
+		free(lvl->face);
+		free(lvl->BCsides);
+		free(lvl->cellFaceStart);
+		free(lvl->cellFace);
+		free(lvl->area);
+		free(lvl->res);
+		free(lvl->forcing);
+		free(lvl->faceFlux);
+		free(lvl->cVarRestr);
+		free(lvl->cVarStage);
+		free(lvl->dt);
+		if (iLevel > 0) {
+			free(lvl->cVar);
+			free(lvl->pVar);
+		}
+	}
+	free(mgLevel);
+}
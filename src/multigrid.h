@@ -0,0 +1,18 @@
+/** \file
+ *
+ * \author hhh
+ * \date Sun 18 Oct 2026 06:41:09 PM CEST
+ */
+
+#ifndef MULTIGRID_H
+#define MULTIGRID_H
+
+extern int nMGlevels;
+extern int mgCycle;
+extern double mgWork;
+
+void initMultigrid(void);
+void multigridCorrection(double time);
+void freeMultigrid(void);
+
+#endif
@@ -58,27 +58,23 @@ void csvOutput(char fileName[STRLEN], double time, bool doExact)
 	/* prepare data (only for equidistant grids) */
 	double **flowData = dyn2DdblArray(nElems, NVAR);
 	if (doExact) {
-		long iElem = 0;
 		elem_t *aElem = firstElem;
 		double pVar[NVAR];
 		while (aElem) {
 			exactFunc(intExactFunc, aElem->bary, time, pVar);
-			flowData[iElem][0] = aElem->bary[X];
-			flowData[iElem][1] = pVar[RHO];
-			flowData[iElem][2] = pVar[VX];
-			flowData[iElem][3] = pVar[P];
-			iElem++;
+			flowData[aElem->fileId][0] = aElem->bary[X];
+			flowData[aElem->fileId][1] = pVar[RHO];
+			flowData[aElem->fileId][2] = pVar[VX];
+			flowData[aElem->fileId][3] = pVar[P];
 			aElem = aElem->next;
 		}
 	} else {
-		long iElem = 0;
 		elem_t *aElem = firstElem;
 		while (aElem) {
-			flowData[iElem][0] = aElem->bary[X];
-			flowData[iElem][1] = aElem->pVar[RHO];
-			flowData[iElem][2] = aElem->pVar[VX];
-			flowData[iElem][3] = aElem->pVar[P];
-			iElem++;
+			flowData[aElem->fileId][0] = aElem->bary[X];
+			flowData[aElem->fileId][1] = aElem->pVar[RHO];
+			flowData[aElem->fileId][2] = aElem->pVar[VX];
+			flowData[aElem->fileId][3] = aElem->pVar[P];
 			aElem = aElem->next;
 		}
 	}
@@ -177,11 +173,11 @@ void cgnsOutput(char fileName[STRLEN], double time, bool doExact)
 			double pVar[NVAR];
 			exactFunc(intExactFunc, aElem->bary, time, pVar);
 
-			rhoArr[aElem->id] = pVar[RHO];
-			vxArr[aElem->id]  = pVar[VX];
-			vyArr[aElem->id]  = pVar[VY];
-			vzArr[aElem->id]  = 0.0;
-			pArr[aElem->id]   = pVar[P];
+			rhoArr[aElem->fileId] = pVar[RHO];
+			vxArr[aElem->fileId]  = pVar[VX];
+			vyArr[aElem->fileId]  = pVar[VY];
+			vzArr[aElem->fileId]  = 0.0;
+			pArr[aElem->fileId]   = pVar[P];
 
 			aElem = aElem->next;
 		}
@@ -190,11 +186,11 @@ void cgnsOutput(char fileName[STRLEN], double time, bool doExact)
 
 		while (aElem) {
 
-			rhoArr[aElem->id] = aElem->pVar[RHO];
-			vxArr[aElem->id]  = aElem->pVar[VX];
-			vyArr[aElem->id]  = aElem->pVar[VY];
-			vzArr[aElem->id]  = 0.0;
-			pArr[aElem->id]   = aElem->pVar[P];
+			rhoArr[aElem->fileId] = aElem->pVar[RHO];
+			vxArr[aElem->fileId]  = aElem->pVar[VX];
+			vyArr[aElem->fileId]  = aElem->pVar[VY];
+			vzArr[aElem->fileId]  = 0.0;
+			pArr[aElem->fileId]   = aElem->pVar[P];
 
 			aElem = aElem->next;
 		}
@@ -255,30 +251,26 @@ void curveOutput(char fileName[STRLEN], double time, bool doExact)
 	/* prepare data */
 	double **flowData = dyn2DdblArray(nElems, NVAR);
 	if (doExact) {
-		long iElem = 0;
 		elem_t *aElem = firstElem;
 		while (aElem) {
 			double pVar[NVAR];
 			exactFunc(intExactFunc, aElem->bary, time, pVar);
 
-			flowData[iElem][0] = aElem->bary[X];
-			flowData[iElem][1] = pVar[RHO];
-			flowData[iElem][2] = pVar[VX];
-			flowData[iElem][3] = pVar[P];
+			flowData[aElem->fileId][0] = aElem->bary[X];
+			flowData[aElem->fileId][1] = pVar[RHO];
+			flowData[aElem->fileId][2] = pVar[VX];
+			flowData[aElem->fileId][3] = pVar[P];
 
-			iElem++;
 			aElem = aElem->next;
 		}
 	} else {
-		long iElem = 0;
 		elem_t *aElem = firstElem;
 		while (aElem) {
-			flowData[iElem][0] = aElem->bary[X];
-			flowData[iElem][1] = aElem->pVar[RHO];
-			flowData[iElem][2] = aElem->pVar[VX];
-			flowData[iElem][3] = aElem->pVar[P];
+			flowData[aElem->fileId][0] = aElem->bary[X];
+			flowData[aElem->fileId][1] = aElem->pVar[RHO];
+			flowData[aElem->fileId][2] = aElem->pVar[VX];
+			flowData[aElem->fileId][3] = aElem->pVar[P];
 
-			iElem++;
 			aElem = aElem->next;
 		}
 	}
@@ -552,21 +544,23 @@ void cgnsWriteMesh(void)
 		aNode = aNode->next;
 	}
 
-	/* save element connectivity in a CGNS compatible format */
-	long iTria = 0, iQuad = 0;
+	/* save element connectivity in a CGNS compatible format, in the order
+	 * of the mesh file: triangles first, then quadrangles */
 	elem_t *aElem = firstElem;
 	while (aElem) {
+		long iTria = aElem->fileId;
+		long iQuad = aElem->fileId - nTrias;
 		switch (aElem->elemType) {
 		case 3:
-			trias[iTria  ][0] = aElem->node[0]->id + 1;
-			trias[iTria  ][1] = aElem->node[1]->id + 1;
-			trias[iTria++][2] = aElem->node[2]->id + 1;
+			trias[iTria][0] = aElem->node[0]->id + 1;
+			trias[iTria][1] = aElem->node[1]->id + 1;
+			trias[iTria][2] = aElem->node[2]->id + 1;
 			break;
 		case 4:
-			quads[iQuad  ][0] = aElem->node[0]->id + 1;
-			quads[iQuad  ][1] = aElem->node[1]->id + 1;
-			quads[iQuad  ][2] = aElem->node[2]->id + 1;
-			quads[iQuad++][3] = aElem->node[3]->id + 1;
+			quads[iQuad][0] = aElem->node[0]->id + 1;
+			quads[iQuad][1] = aElem->node[1]->id + 1;
+			quads[iQuad][2] = aElem->node[2]->id + 1;
+			quads[iQuad][3] = aElem->node[3]->id + 1;
 			break;
 		}
 
@@ -7,9 +7,30 @@
 #ifndef RECONSTRUCTION_H
 #define RECONSTRUCTION_H
 
+#include "main.h"
+
 extern int limiter;
 extern double venk_k;
+extern void (*spatialReconstruction)(double time);
+extern double (*phiFrozen)[NVAR];
+
+/**
+ * \brief List of the spatial reconstructions, first order and second order
+ *	with each of the limiters or with the frozen limiter values
+ */
+#define RECONSTRUCTIONS(X) \
+	X(firstOrder) \
+	X(barthJespersen) \
+	X(venkatakrishnan) \
+	X(frozenLimiter)
+
+#define RECONSTRUCTION_PROTOTYPE(name) \
+	void spatialReconstruction_##name(double time); \
+	void spatialReconstruction_##name##Dual(double time);
+RECONSTRUCTIONS(RECONSTRUCTION_PROTOTYPE)
+#undef RECONSTRUCTION_PROTOTYPE
 
-void spatialReconstruction(double time);
+void freezeLimiter(double time);
+void freeReconstruction(void);
 
 #endif
@@ -0,0 +1,258 @@
+/** \file
+ *
+ * \brief Reconstruction and limiter kernels, compiled for double values and
+ *	for dual numbers, see scalar.h
+ *
+ * \author hhh
+ * \date Sun 18 Oct 2026 06:41:09 PM CEST
+ */
+
+/**
+ * \brief Limiter value of Barth & Jespersen at one side
+ * \param[in] uDiff Unlimited difference between the side GP and the barycenter
+ * \param[in] diff Difference between the extremum of the neighbor values and
+ *	the barycenter, the maximum for positive `uDiff`, the minimum otherwise
+ * \param[in] venkEps_sq Unused, for the same interface as Venkatakrishnan
+ * \return The limiter value, not valid for `uDiff` equal to zero
+ */
+real NAME(phiBarthJespersen)(real uDiff, real diff, double venkEps_sq)
+{
+	(void)venkEps_sq;
+	real phi = diff / uDiff;
+	return (RE(phi) < 1.0 ? phi : 1.0);
+}
+
+/**
+ * \brief Limiter value of Venkatakrishnan at one side, with additional
+ *	limiting parameter k
+ * \param[in] uDiff Unlimited difference between the side GP and the barycenter
+ * \param[in] diff Difference between the extremum of the neighbor values and
+ *	the barycenter, the maximum for positive `uDiff`, the minimum otherwise
+ * \param[in] venkEps_sq Limiting parameter of the element
+ * \return The limiter value, not valid for `uDiff` equal to zero
+ */
+real NAME(phiVenkatakrishnan)(real uDiff, real diff, double venkEps_sq)
+{
+	real diffsq = diff * diff;
+	real uDiffsq = uDiff * uDiff;
+	return 1.0 / uDiff * (((diffsq + venkEps_sq) * uDiff + 2.0 * uDiffsq * diff)
+			/ (diffsq + 2.0 * uDiffsq + uDiff * diff + venkEps_sq));
+}
+
+/**
+ * \brief Generate a limiter for elements with a fixed number of sides
+ *
+ * The neighbor states and side GPs are gathered into contiguous arrays in a
+ * single walk over the sides. With the number of sides known at compile
+ * time, the loops over the sides are unrolled, and the loops over the
+ * variables are free of branches, so that they are vectorized across the
+ * variables: the sign of the unlimited difference only selects the extremum,
+ * and the minima and maxima are selections instead of calls to fmin and fmax,
+ * which have to handle NaN.
+ */
+#define FIXED_ARITY_LIMITER(name, nSides) \
+void NAME(limiter##name##_##nSides)(long iElem, real phi[NVAR]) \
+{ \
+	real *pVar = STATE.pVar[iElem]; \
+	real *u_x = STATE.u_x[iElem]; \
+	real *u_y = STATE.u_y[iElem]; \
+	double venkEps_sq = elem[iElem]->venkEps_sq; \
+	long kStart = elemSideStart[iElem]; \
+ \
+	/* gather the neighbor states and side GPs */ \
+	real pVarNB[nSides][NVAR]; \
+	double GP[nSides][NDIM]; \
+	for (int i = 0; i < nSides; ++i) { \
+		real *pVarK = STATE.pVar[elemNB[kStart + i]]; \
+		double *GPK = sideData.GP[elemSide[kStart + i]]; \
+		pVarNB[i][RHO] = pVarK[RHO]; \
+		pVarNB[i][VX]  = pVarK[VX]; \
+		pVarNB[i][VY]  = pVarK[VY]; \
+		pVarNB[i][P]   = pVarK[P]; \
+		GP[i][X] = GPK[X]; \
+		GP[i][Y] = GPK[Y]; \
+	} \
+ \
+	/* determine the differences to the neighbor minimum and maximum */ \
+	real minDiff[NVAR], maxDiff[NVAR]; \
+	_Pragma("omp simd") \
+	for (int iVar = 0; iVar < NVAR; ++iVar) { \
+		real uMin = pVar[iVar], uMax = pVar[iVar]; \
+		for (int i = 0; i < nSides; ++i) { \
+			real uNB = pVarNB[i][iVar]; \
+			uMin = (RE(uNB) < RE(uMin) ? uNB : uMin); \
+			uMax = (RE(uNB) > RE(uMax) ? uNB : uMax); \
+		} \
+		minDiff[iVar] = uMin - pVar[iVar]; \
+		maxDiff[iVar] = uMax - pVar[iVar]; \
+	} \
+ \
+	/* determine phi over all sides */ \
+	_Pragma("omp simd") \
+	for (int iVar = 0; iVar < NVAR; ++iVar) { \
+		real phiVar = 1.0; \
+		for (int i = 0; i < nSides; ++i) { \
+			real uDiff = u_x[iVar] * GP[i][X] + u_y[iVar] * GP[i][Y]; \
+			real diff = (RE(uDiff) > 0.0 ? maxDiff[iVar] : minDiff[iVar]); \
+			real phiLoc = NAME(phi##name)(uDiff, diff, venkEps_sq); \
+			phiLoc = (RE(uDiff) != 0.0 ? phiLoc : 1.0); \
+			phiVar = (RE(phiLoc) < RE(phiVar) ? phiLoc : phiVar); \
+		} \
+		phi[iVar] = phiVar; \
+	} \
+}
+
+FIXED_ARITY_LIMITER(BarthJespersen, 3)
+FIXED_ARITY_LIMITER(BarthJespersen, 4)
+FIXED_ARITY_LIMITER(Venkatakrishnan, 3)
+FIXED_ARITY_LIMITER(Venkatakrishnan, 4)
+
+/**
+ * \brief Limiter after Barth & Jespersen
+ * \note 2D, unstructured limiter, for triangles and quadrilaterals
+ * \param[in] iElem Element ID
+ * \param[out] phi Limiter value of every variable
+ */
+void NAME(limiterBarthJespersen)(long iElem, real phi[NVAR])
+{
+	if (elemSideStart[iElem + 1] - elemSideStart[iElem] == 3) {
+		NAME(limiterBarthJespersen_3)(iElem, phi);
+	} else {
+		NAME(limiterBarthJespersen_4)(iElem, phi);
+	}
+}
+
+/**
+ * \brief Limiter after Venkatakrishnan, with additional limiting parameter k
+ * \note 2D, unstructured limiter, for triangles and quadrilaterals
+ * \param[in] iElem Element ID
+ * \param[out] phi Limiter value of every variable
+ */
+void NAME(limiterVenkatakrishnan)(long iElem, real phi[NVAR])
+{
+	if (elemSideStart[iElem + 1] - elemSideStart[iElem] == 3) {
+		NAME(limiterVenkatakrishnan_3)(iElem, phi);
+	} else {
+		NAME(limiterVenkatakrishnan_4)(iElem, phi);
+	}
+}
+
+/**
+ * \brief Limit the gradient of an element
+ * \param[in] iElem Element ID
+ * \param[in] phi Limiter value of every variable
+ */
+void NAME(limitGradient)(long iElem, const real phi[NVAR])
+{
+	real *u_x = STATE.u_x[iElem];
+	real *u_y = STATE.u_y[iElem];
+
+	/* compute limited gradients */
+	u_x[RHO] *= phi[RHO];
+	u_x[VX]  *= phi[VX];
+	u_x[VY]  *= phi[VY];
+	u_x[P]   *= phi[P];
+
+	u_y[RHO] *= phi[RHO];
+	u_y[VX]  *= phi[VX];
+	u_y[VY]  *= phi[VY];
+	u_y[P]   *= phi[P];
+}
+
+/**
+ * \brief Compute the unlimited gradient of an element
+ * \param[in] iElem Element ID
+ */
+void NAME(gradientReconstruction)(long iElem)
+{
+	real *pVar = STATE.pVar[iElem];
+	real *u_x = STATE.u_x[iElem];
+	real *u_y = STATE.u_y[iElem];
+
+	u_x[RHO] = u_x[VX] = u_x[VY] = u_x[P] = 0.0;
+	u_y[RHO] = u_y[VX] = u_y[VY] = u_y[P] = 0.0;
+
+	for (long k = elemSideStart[iElem]; k < elemSideStart[iElem + 1]; ++k) {
+		real *pVarNB = STATE.pVar[elemNB[k]];
+		double *w = sideData.w[elemSide[k]];
+
+		real pDiff[NVAR];
+		pDiff[RHO] = pVarNB[RHO] - pVar[RHO];
+		pDiff[VX]  = pVarNB[VX]  - pVar[VX];
+		pDiff[VY]  = pVarNB[VY]  - pVar[VY];
+		pDiff[P]   = pVarNB[P]   - pVar[P];
+
+		u_x[RHO] += w[X] * pDiff[RHO];
+		u_x[VX]  += w[X] * pDiff[VX];
+		u_x[VY]  += w[X] * pDiff[VY];
+		u_x[P]   += w[X] * pDiff[P];
+
+		u_y[RHO] += w[Y] * pDiff[RHO];
+		u_y[VX]  += w[Y] * pDiff[VX];
+		u_y[VY]  += w[Y] * pDiff[VY];
+		u_y[P]   += w[Y] * pDiff[P];
+	}
+}
+
+/**
+ * \brief First order reconstruction, the side states equal the mean values
+ *
+ * The gradients stay zero, as they are allocated, so there is nothing to do.
+ *
+ * \param[in] time Calculation time at which to perform the spatial reconstruction
+ */
+void NAME(spatialReconstruction_firstOrder)(double time)
+{
+	(void)time;	/* no boundary states are needed at first order */
+}
+
+/**
+ * \brief Generate the second order reconstruction for a limiter
+ *
+ * The gradients are computed and limited by the given limiter function in a
+ * single pass over the elements. The limiter is called directly, so that it
+ * can be inlined into the element loop. The values at the side GPs are not
+ * stored, they are extrapolated from the gradients during the flux
+ * calculation.
+ */
+#define SECOND_ORDER_RECONSTRUCTION(name, limiterFunction) \
+void NAME(spatialReconstruction_##name)(double time) \
+{ \
+	NAME(setBCatBarys)(time); \
+ \
+	_Pragma("omp parallel for") \
+	for (long iElem = 0; iElem < nElems; ++iElem) { \
+		real phi[NVAR]; \
+		NAME(gradientReconstruction)(iElem); \
+		NAME(limiterFunction)(iElem, phi); \
+		NAME(limitGradient)(iElem, phi); \
+	} \
+}
+
+SECOND_ORDER_RECONSTRUCTION(barthJespersen, limiterBarthJespersen)
+SECOND_ORDER_RECONSTRUCTION(venkatakrishnan, limiterVenkatakrishnan)
+
+/**
+ * \brief Second order reconstruction with the frozen limiter values
+ *
+ * The gradients are limited with the values stored by `freezeLimiter`, the
+ * scan of the neighbor values is skipped.
+ *
+ * \param[in] time Calculation time at which to perform the spatial reconstruction
+ */
+void NAME(spatialReconstruction_frozenLimiter)(double time)
+{
+	NAME(setBCatBarys)(time);
+
+	#pragma omp parallel for
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		real phi[NVAR];
+		phi[RHO] = phiFrozen[iElem][RHO];
+		phi[VX]  = phiFrozen[iElem][VX];
+		phi[VY]  = phiFrozen[iElem][VY];
+		phi[P]   = phiFrozen[iElem][P];
+
+		NAME(gradientReconstruction)(iElem);
+		NAME(limitGradient)(iElem, phi);
+	}
+}
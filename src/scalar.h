@@ -0,0 +1,77 @@
+/** \file
+ *
+ * \brief Instantiate the kernels of the spatial operator for double values
+ *	and for dual numbers
+ *
+ * The kernels of the spatial operator, from the primitive variables to the
+ * time derivative, are written once in terms of the scalar type `real` and
+ * are compiled twice by including this file: for double values, and for dual
+ * numbers, which give the exact Jacobian-vector products. The file with the
+ * kernels is given by `SCALAR_KERNELS`. Inside the kernels
+ *	- `real` is the type of all values depending on the state,
+ *	- `NAME(name)` is the name of a kernel, the dual number kernels get the
+ *	  suffix `Dual`,
+ *	- `STATE` holds the states, gradients and flux balances of the elements,
+ *	- `RE(x)` is the value of `x`, which is used in all comparisons,
+ *	- `SQRT`, `FABS`, `FMIN` and `FMAX` replace the functions of math.h,
+ *	- `DUAL_NUMBERS` is defined while the dual numbers are instantiated.
+ *
+ * The kernel files have no include guards, they are only included through
+ * this file, which is included after all other headers.
+ *
+ * \author hhh
+ * \date Sun 18 Oct 2026 06:41:09 PM CEST
+ */
+
+#include <math.h>
+
+#include "dualNumber.h"
+#include "mesh.h"
+
+/* complex.h defines I, which memTools.h uses as a parameter name */
+#include <complex.h>
+
+/* double values */
+#define real double
+#define NAME(name) name
+#define STATE elemData
+#define RE(x) (x)
+#define SQRT(x) sqrt(x)
+#define FABS(x) fabs(x)
+#define FMIN(a, b) fmin(a, b)
+#define FMAX(a, b) fmax(a, b)
+
+#include SCALAR_KERNELS
+
+#undef real
+#undef NAME
+#undef STATE
+#undef RE
+#undef SQRT
+#undef FABS
+#undef FMIN
+#undef FMAX
+
+/* dual numbers */
+#define DUAL_NUMBERS
+#define real dual_t
+#define NAME(name) name##Dual
+#define STATE dualData
+#define RE(x) creal(x)
+#define SQRT(x) dualSqrt(x)
+#define FABS(x) dualAbs(x)
+#define FMIN(a, b) dualMin(a, b)
+#define FMAX(a, b) dualMax(a, b)
+
+#include SCALAR_KERNELS
+
+#undef DUAL_NUMBERS
+#undef real
+#undef NAME
+#undef STATE
+#undef RE
+#undef SQRT
+#undef FABS
+#undef FMIN
+#undef FMAX
+#undef SCALAR_KERNELS
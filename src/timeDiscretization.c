@@ -23,8 +23,30 @@
 #include "linearSolver.h"
 #include "equationOfState.h"
 #include "finiteVolume.h"
+#include "multigrid.h"
 #include "memTools.h"
 
+#define CFL_CUTBACK 0.5		/**< reduction of the CFL number if the Newton
+					method does not converge */
+#define MAX_CUTBACKS 10		/**< maximum number of consecutive
+					reductions of the CFL number */
+#define SER_MAX_GROWTH 2.0	/**< maximum growth of the CFL number per
+					time step */
+#define LINE_SEARCH_STEPS 8	/**< maximum number of halvings of the
+					Newton update in the line search */
+#define ERK_MAX_STAGES 7	/**< maximum number of stages of the
+					embedded Runge-Kutta pairs */
+#define ERK_SAFETY 0.9		/**< safety factor of the time step
+					controller */
+#define ERK_MIN_FACTOR 0.2	/**< maximum reduction of the time step by
+					the controller */
+#define ERK_MAX_FACTOR 5.0	/**< maximum growth of the time step by the
+					controller */
+#define ERK_ALPHA 0.7		/**< exponent of the current error in the
+					PI controller, times the order */
+#define ERK_BETA 0.4		/**< exponent of the last error in the PI
+					controller, times the order */
+
 /* extern variables */
 double	cfl;				/**< Courant-Friedrichs-Lewy number */
 double	dfl;				/**< diffusive Courant-Friedrichs-Lewy number */
@@ -36,6 +58,7 @@ int	timeOrder;			/**< order of the time integration */
 bool	isTimeStep1D;			/**< flag for 1D problem */
 
 bool	isStationary;			/**< flag for stationary problem */
+bool	isLocalTimeStep;		/**< flag for local time stepping */
 long	maxIter;			/**< maximum number of iterations */
 double	stopTime;			/**< simulation end time */
 long	iniIterationNumber;		/**< initial iteration number */
@@ -55,6 +78,8 @@ double	printTime;			/**< calculation time after which to output */
 
 int	nRKstages;			/**< number of Runge-Kutta stages */
 double	RKcoeff[6] = {0.0};		/**< array of Runge-Kutta coefficients */
+bool	isLowStorageRK;			/**< flag for the low-storage Runge-Kutta
+					schemes */
 bool	isImplicit;			/**< implicit calculation flag */
 
 /* local variables */
@@ -62,6 +87,201 @@ double **deltaX;			/**< variable used in implicit calculation */
 double **Q;				/**< variable used in implicit calculation */
 double **F_X0;				/**< variable used in implicit calculation */
 double **F_XK;				/**< variable used in implicit calculation */
+double RKa[6];				/**< coefficients of the register update of
+					the low-storage Runge-Kutta schemes */
+double RKb[6];				/**< coefficients of the solution update of
+					the low-storage Runge-Kutta schemes */
+double RKc[6];				/**< stage times of the low-storage
+					Runge-Kutta schemes */
+double cflInit;				/**< CFL number of the parameter file */
+double cflMax;				/**< maximum CFL number of the SER ramping,
+					0 if disabled */
+double resSER;				/**< residual of the last time step, for
+					the SER ramping */
+int nCutbacks;				/**< number of consecutive reductions of
+					the CFL number */
+bool isLineSearch;			/**< flag for the line search of the Newton
+					update */
+double maxUpdate;			/**< maximum relative change of density and
+					pressure per Newton iteration */
+double residualSmoothing;		/**< coefficient of the implicit residual
+					smoothing, 0 if disabled */
+int nSmoothingSweeps;			/**< number of Jacobi sweeps of the
+					residual smoothing */
+double (*u_tSmooth)[NVAR];		/**< smoothed time derivative */
+double (*u_tSweep)[NVAR];		/**< time derivative of the next Jacobi
+					sweep */
+int embeddedRK;				/**< embedded Runge-Kutta pair, 0 if
+					disabled */
+int nERKstages;				/**< number of stages of the embedded
+					Runge-Kutta pair */
+int errorOrder;				/**< order of the embedded solution plus
+					one, for the time step controller */
+double ERKa[ERK_MAX_STAGES][ERK_MAX_STAGES];	/**< Butcher tableau of the
+							embedded pair */
+double ERKc[ERK_MAX_STAGES];		/**< stage times of the embedded pair */
+double ERKe[ERK_MAX_STAGES];		/**< weights of the error estimate of
+					the embedded pair */
+double (*ERKk[ERK_MAX_STAGES])[NVAR];	/**< time derivatives of the stages */
+bool isFSALvalid;			/**< flag if the first stage is the last
+					stage of the last time step */
+double errorTolerance;			/**< tolerance of the temporal error */
+double dtError;				/**< time step of the controller */
+double errorOld;			/**< error estimate of the last accepted
+					time step */
+long nRejectedSteps;			/**< number of rejected time steps */
+
+/**
+ * \brief Set the coefficients of the low-storage Runge-Kutta schemes
+ *
+ * The schemes are given in the 2N form of Williamson: every stage updates
+ * the register dU = a * dU + dt * R(U) and the solution U = U + b * dU.
+ */
+void initLowStorageRK(void)
+{
+	if ((nRKstages == 3) && (timeOrder == 3)) {
+		printf("| Time Stepping Scheme: Low-Storage RK3 of Williamson\n");
+		RKa[1] = 0.0;
+		RKa[2] = - 5.0 / 9.0;
+		RKa[3] = - 153.0 / 128.0;
+
+		RKb[1] = 1.0 / 3.0;
+		RKb[2] = 15.0 / 16.0;
+		RKb[3] = 8.0 / 15.0;
+
+		RKc[1] = 0.0;
+		RKc[2] = 1.0 / 3.0;
+		RKc[3] = 3.0 / 4.0;
+	} else if ((nRKstages == 5) && (timeOrder == 4)) {
+		printf("| Time Stepping Scheme: Low-Storage RK4 of Carpenter and Kennedy\n");
+		RKa[1] = 0.0;
+		RKa[2] = - 567301805773.0 / 1357537059087.0;
+		RKa[3] = - 2404267990393.0 / 2016746695238.0;
+		RKa[4] = - 3550918686646.0 / 2091501179385.0;
+		RKa[5] = - 1275806237668.0 / 842570457699.0;
+
+		RKb[1] = 1432997174477.0 / 9575080441755.0;
+		RKb[2] = 5161836677717.0 / 13612068292357.0;
+		RKb[3] = 1720146321549.0 / 2090206949498.0;
+		RKb[4] = 3134564353537.0 / 4481467310338.0;
+		RKb[5] = 2277821191437.0 / 14882151754819.0;
+
+		RKc[1] = 0.0;
+		RKc[2] = 1432997174477.0 / 9575080441755.0;
+		RKc[3] = 2526269341429.0 / 6820363962896.0;
+		RKc[4] = 2006345519317.0 / 3224310063776.0;
+		RKc[5] = 2802321613138.0 / 2924317926251.0;
+	} else {
+		printf("| ERROR: Low-Storage RK needs 3 stages and order 3, or 5 stages and order 4\n");
+		exit(1);
+	}
+}
+
+/**
+ * \brief Set the Butcher tableau of the embedded Runge-Kutta pairs
+ *
+ * Both pairs use the solution of higher order and have the property first
+ * same as last: the last stage is evaluated at the new solution and is the
+ * first stage of the next time step. ERKe holds the difference of the
+ * weights of both solutions.
+ */
+void initEmbeddedRK(void)
+{
+	if (isImplicit || isStationary) {
+		printf("| ERROR: Embedded RK is only available for explicit transient problems\n");
+		exit(1);
+	}
+
+	if (isLowStorageRK) {
+		printf("| ERROR: Embedded RK and Low-Storage RK are exclusive\n");
+		exit(1);
+	}
+
+	switch (embeddedRK) {
+	case 1:
+		printf("| Time Stepping Scheme: Embedded RK of Bogacki and Shampine 3(2)\n");
+		nERKstages = 4;
+		errorOrder = 3;
+
+		ERKa[1][0] = 1.0 / 2.0;
+		ERKa[2][1] = 3.0 / 4.0;
+		ERKa[3][0] = 2.0 / 9.0;
+		ERKa[3][1] = 1.0 / 3.0;
+		ERKa[3][2] = 4.0 / 9.0;
+
+		ERKc[1] = 1.0 / 2.0;
+		ERKc[2] = 3.0 / 4.0;
+		ERKc[3] = 1.0;
+
+		ERKe[0] = - 5.0 / 72.0;
+		ERKe[1] = 1.0 / 12.0;
+		ERKe[2] = 1.0 / 9.0;
+		ERKe[3] = - 1.0 / 8.0;
+		break;
+	case 2:
+		printf("| Time Stepping Scheme: Embedded RK of Dormand and Prince 5(4)\n");
+		nERKstages = 7;
+		errorOrder = 5;
+
+		ERKa[1][0] = 1.0 / 5.0;
+		ERKa[2][0] = 3.0 / 40.0;
+		ERKa[2][1] = 9.0 / 40.0;
+		ERKa[3][0] = 44.0 / 45.0;
+		ERKa[3][1] = - 56.0 / 15.0;
+		ERKa[3][2] = 32.0 / 9.0;
+		ERKa[4][0] = 19372.0 / 6561.0;
+		ERKa[4][1] = - 25360.0 / 2187.0;
+		ERKa[4][2] = 64448.0 / 6561.0;
+		ERKa[4][3] = - 212.0 / 729.0;
+		ERKa[5][0] = 9017.0 / 3168.0;
+		ERKa[5][1] = - 355.0 / 33.0;
+		ERKa[5][2] = 46732.0 / 5247.0;
+		ERKa[5][3] = 49.0 / 176.0;
+		ERKa[5][4] = - 5103.0 / 18656.0;
+		ERKa[6][0] = 35.0 / 384.0;
+		ERKa[6][2] = 500.0 / 1113.0;
+		ERKa[6][3] = 125.0 / 192.0;
+		ERKa[6][4] = - 2187.0 / 6784.0;
+		ERKa[6][5] = 11.0 / 84.0;
+
+		ERKc[1] = 1.0 / 5.0;
+		ERKc[2] = 3.0 / 10.0;
+		ERKc[3] = 4.0 / 5.0;
+		ERKc[4] = 8.0 / 9.0;
+		ERKc[5] = 1.0;
+		ERKc[6] = 1.0;
+
+		ERKe[0] = 71.0 / 57600.0;
+		ERKe[2] = - 71.0 / 16695.0;
+		ERKe[3] = 71.0 / 1920.0;
+		ERKe[4] = - 17253.0 / 339200.0;
+		ERKe[5] = 22.0 / 525.0;
+		ERKe[6] = - 1.0 / 40.0;
+		break;
+	default:
+		printf("| ERROR: Embedded RK must be either 0, 1 or 2\n");
+		exit(1);
+	}
+
+	errorTolerance = getDbl("errorTolerance", "1e-4");
+	if (errorTolerance <= 0.0) {
+		printf("| ERROR: Error Tolerance must be positive\n");
+		exit(1);
+	}
+
+	for (int iStage = 0; iStage < nERKstages; ++iStage) {
+		ERKk[iStage] = malloc(nElems * sizeof(double[NVAR]));
+		if (!ERKk[iStage]) {
+			printf("| ERROR: could not allocate embedded RK stages\n");
+			exit(1);
+		}
+	}
+
+	isFSALvalid = false;
+	dtError = 1e150;
+	errorOld = 1.0;
+	nRejectedSteps = 0;
+}
 
 /**
  * \brief Initialize the time discretization
@@ -73,8 +293,8 @@ void initTimeDisc(void)
 	dfl = getDbl("DFL", "0.9");
 	isTimeStep1D = getBool("timeStep1D", "F");
 	timeOrder = getInt("timeOrder", "1");
-	if (timeOrder > 3) {
-		printf("| ERROR: Temporal Discretization Order must be either 1, 2 or 3\n");
+	if (timeOrder > 4) {
+		printf("| ERROR: Temporal Discretization Order must be either 1, 2, 3 or 4\n");
 		exit(1);
 	}
 
@@ -84,18 +304,53 @@ void initTimeDisc(void)
 		Q = dyn2DdblArray(NVAR, nElems);
 		F_X0 = dyn2DdblArray(NVAR, nElems);
 		F_XK = dyn2DdblArray(NVAR, nElems);
+
+		cflMax = 0.0;
+		if (isStationary) {
+			cflMax = getDbl("cflMax", "0");
+			if (cflMax > cfl) {
+				printf("| SER CFL Ramping: %g to %g\n", cfl, cflMax);
+			}
+		}
+
+		isLineSearch = getBool("lineSearch", "F");
+		if (isLineSearch) {
+			maxUpdate = getDbl("maxUpdate", "0.2");
+		}
 	}
+	cflInit = cfl;
+	resSER = 0.0;
+	nCutbacks = 0;
 
 	nRKstages = getInt("nRKstages", "1");
 	if (nRKstages > 5) {
 		printf("| ERROR: No more than 5 RK Stages are Possible\n");
 		exit(1);
 	}
-	if ((nRKstages == 1) && (timeOrder == 1)) {
+
+	isLowStorageRK = false;
+	if (!isImplicit) {
+		isLowStorageRK = getBool("lowStorageRK", "F");
+	}
+
+	embeddedRK = 0;
+	if (!isImplicit) {
+		embeddedRK = getInt("embeddedRK", "0");
+	}
+
+	if (embeddedRK > 0) {
+		initEmbeddedRK();
+	} else if (isLowStorageRK) {
+		initLowStorageRK();
+	} else if ((nRKstages == 1) && (timeOrder == 1)) {
 		printf("| Time Stepping Scheme: Euler Time Stepping\n");
 		RKcoeff[1] = 1.0;
 	} else {
 		printf("| Time Stepping Scheme: RK Time Stepping\n");
+		if (timeOrder > 3) {
+			printf("| ERROR: Order 4 is only available for low-storage RK\n");
+			exit(1);
+		}
 		switch (nRKstages) {
 		case 3:
 			switch (timeOrder) {
@@ -177,6 +432,31 @@ void initTimeDisc(void)
 		printf("| %16s[%d] = %27s\n", "RKcoeff", nRKstages, line);
 	}
 
+	/* implicit residual smoothing for explicit stationary computations */
+	residualSmoothing = 0.0;
+	if (!isImplicit) {
+		residualSmoothing = getDbl("residualSmoothing", "0");
+	}
+	if (residualSmoothing > 0.0) {
+		if (!isStationary) {
+			printf("| ERROR: Residual Smoothing is only available for stationary problems\n");
+			exit(1);
+		}
+
+		nSmoothingSweeps = getInt("smoothingSweeps", "2");
+		if (nSmoothingSweeps < 1) {
+			printf("| ERROR: Residual Smoothing needs at least one sweep\n");
+			exit(1);
+		}
+
+		u_tSmooth = malloc(nElems * sizeof(double[NVAR]));
+		u_tSweep = malloc(nElems * sizeof(double[NVAR]));
+		if (!u_tSmooth || !u_tSweep) {
+			printf("| ERROR: could not allocate residual smoothing\n");
+			exit(1);
+		}
+	}
+
 	/* stationary computation */
 	if (isStationary) {
 		doAbortOnClResidual = doAbortOnCdResidual = false;
@@ -199,6 +479,11 @@ void initTimeDisc(void)
 			break;
 		}
 
+		isLocalTimeStep = getBool("localTimeStep", "F");
+		if (isLocalTimeStep) {
+			printf("| Local Time Stepping\n");
+		}
+
 		clAbortResidual = getDbl("cl_abortResidual", "0.0");
 		cdAbortResidual = getDbl("cd_abortResidual", "0.0");
 
@@ -218,6 +503,7 @@ void initTimeDisc(void)
 		}
 	} else {
 		printf("| Transient Problem\n");
+		isLocalTimeStep = false;
 	}
 
 	maxIter = getInt("maxIter", "100000");
@@ -241,8 +527,12 @@ void initTimeDisc(void)
 
 /**
  * \brief Compute the time step
+ *
+ * For local time stepping every element keeps its own time step, otherwise
+ * the global time step is set for all elements.
+ *
  * \param[in] pTime The print time interval
- * \param[out] dt The resulting time step
+ * \param[out] dt The resulting global time step
  * \param[out] viscousTimeStepDominates Flag for if the viscous time step is
  *	dominating
  */
@@ -255,8 +545,9 @@ void calcTimeStep(double pTime, double *dt, bool *viscousTimeStepDominates)
 		#pragma omp parallel for reduction(min:dtMax)
 		for (long iElem = 0; iElem < nElems; ++iElem) {
 			elem_t *aElem = elem[iElem];
-			double a = sqrt(gam * aElem->pVar[P] / aElem->pVar[RHO]);
-			double dtConv = cfl * aElem->sy / (fabs(aElem->pVar[VX]) + a);
+			double *pVar = elemData.pVar[iElem];
+			double a = sqrt(gam * pVar[P] / pVar[RHO]);
+			double dtConv = cfl * aElem->sy / (fabs(pVar[VX]) + a);
 			if (!isfinite(dtConv)) {
 				printf("| Convective Time Step NaN\n");
 				exit(1);
@@ -265,6 +556,7 @@ void calcTimeStep(double pTime, double *dt, bool *viscousTimeStepDominates)
 				printf("| TimeStep1D not implemented for Navier Stokes. Set mu = 0 or turn off timeStep1D\n");
 				exit(1);
 			}
+			elemData.dt[iElem] = dtConv;
 			dtMax = fmin(dtMax, dtConv);
 		}
 
@@ -275,15 +567,17 @@ void calcTimeStep(double pTime, double *dt, bool *viscousTimeStepDominates)
 		#pragma omp parallel for reduction(min:dtConvMax)
 		for (long iElem = 0; iElem < nElems; ++iElem) {
 			elem_t *aElem = elem[iElem];
+			double *pVar = elemData.pVar[iElem];
 			/* convective time step */
-			double a = sqrt(gam * aElem->pVar[P] / aElem->pVar[RHO]);
-			double sumSpectralRadii = (fabs(aElem->pVar[VX]) + a) * aElem->sx
-						+ (fabs(aElem->pVar[VY]) + a) * aElem->sy;
+			double a = sqrt(gam * pVar[P] / pVar[RHO]);
+			double sumSpectralRadii = (fabs(pVar[VX]) + a) * aElem->sx
+						+ (fabs(pVar[VY]) + a) * aElem->sy;
 			double dtConv = cfl * aElem->area / sumSpectralRadii;
 			if (!isfinite(dtConv)) {
 				printf("| Convective Time Step NaN\n");
 				exit(1);
 			}
+			elemData.dt[iElem] = dtConv;
 			dtConvMax = fmin(dtConvMax, dtConv);
 		}
 
@@ -296,13 +590,15 @@ void calcTimeStep(double pTime, double *dt, bool *viscousTimeStepDominates)
 				double sumSpectralRadii
 					= gamPrMax * mu * aElem->sx * aElem->sx
 					+ gamPrMax * mu * aElem->sy * aElem->sy;
-				double dtVisc = dfl * aElem->pVar[RHO] * aElem->pVar[RHO]
+				double dtVisc = dfl * elemData.pVar[iElem][RHO]
+					* elemData.pVar[iElem][RHO]
 					* aElem->area * aElem->area
 					/ (4.0 * sumSpectralRadii);
 				if (!isfinite(dtVisc)) {
 					printf("| Viscous Time Step NaN\n");
 					exit(1);
 				}
+				elemData.dt[iElem] = fmin(elemData.dt[iElem], dtVisc);
 				dtViscMax = fmin(dtViscMax, dtVisc);
 			}
 		}
@@ -320,96 +616,509 @@ void calcTimeStep(double pTime, double *dt, bool *viscousTimeStepDominates)
 		*dt = 0.5 * (fmin(pTime, stopTime) - t);
 	}
 
+	if (isLocalTimeStep) {
+		return;
+	}
+
 	/* set local time step for each cell to the global time step */
 	#pragma omp parallel for
 	for (long iElem = 0; iElem < nElems; ++iElem) {
-		elem_t *aElem = elem[iElem];
-		aElem->dt = *dt;
+		elemData.dt[iElem] = *dt;
+	}
+}
+
+/**
+ * \brief Implicit residual smoothing of the time derivative
+ *
+ * The smoothed time derivative `Rs` of every element `i` solves
+ *	(1 + eps * n_i) * Rs_i - eps * sum_j Rs_j = R_i,
+ * with the time derivative `R`, the smoothing coefficient `eps` and the `n_i`
+ * inner neighbors `j` of the element. The system is solved approximately by
+ * Jacobi sweeps, starting from the unsmoothed time derivative. The smoothing
+ * damps the high frequencies of the residual, which allows larger CFL numbers
+ * for the Runge-Kutta schemes. The result is stored in `u_tSmooth`,
+ * `elemData.u_t` keeps the unsmoothed time derivative for the residual norms.
+ */
+void smoothTimeDerivative(void)
+{
+	double (*u_t)[NVAR] = elemData.u_t;
+	double (*src)[NVAR] = u_t;
+	for (int iSweep = 0; iSweep < nSmoothingSweeps; ++iSweep) {
+		#pragma omp parallel for
+		for (long iElem = 0; iElem < nElems; ++iElem) {
+			double sum[NVAR] = {0.0};
+			int nNB = 0;
+			for (long k = elemSideStart[iElem]; k < elemSideStart[iElem + 1]; ++k) {
+				long iNB = elemNB[k];
+				if (iNB < nElems) {
+					sum[RHO] += src[iNB][RHO];
+					sum[MX]  += src[iNB][MX];
+					sum[MY]  += src[iNB][MY];
+					sum[E]   += src[iNB][E];
+					nNB++;
+				}
+			}
+
+			double diagq = 1.0 / (1.0 + residualSmoothing * nNB);
+			double *dst = u_tSweep[iElem];
+			dst[RHO] = (u_t[iElem][RHO] + residualSmoothing * sum[RHO]) * diagq;
+			dst[MX]  = (u_t[iElem][MX]  + residualSmoothing * sum[MX])  * diagq;
+			dst[MY]  = (u_t[iElem][MY]  + residualSmoothing * sum[MY])  * diagq;
+			dst[E]   = (u_t[iElem][E]   + residualSmoothing * sum[E])   * diagq;
+		}
+
+		double (*tmp)[NVAR] = u_tSmooth;
+		u_tSmooth = u_tSweep;
+		u_tSweep = tmp;
+		src = u_tSmooth;
 	}
 }
 
 /**
- * \brief Performs explicit time step using Euler scheme
+ * \brief Performs explicit time step using Euler scheme, with the time step of
+ *	each element
  * \param[in] time Computation time at calculation
- * \param[in] dt Time step at calculation
  * \param[out] resIter Residual vector for time step
  */
-void explicitTimeStepEuler(double time, double dt, double resIter[NVAR + 2])
+void explicitTimeStepEuler(double time, double resIter[NVAR + 2])
 {
 	fvTimeDerivative(time);
+	double (*u_tUpdate)[NVAR] = elemData.u_t;
+	if (residualSmoothing > 0.0) {
+		smoothTimeDerivative();
+		u_tUpdate = u_tSmooth;
+	}
 
 	#pragma omp parallel for
 	for (long iElem = 0; iElem < nElems; ++iElem) {
-		elem_t *aElem = elem[iElem];
+		double dt = elemData.dt[iElem];
+		double *cVar = elemData.cVar[iElem];
+		double *u_t = u_tUpdate[iElem];
 
-		aElem->cVar[RHO] += dt * aElem->u_t[RHO];
-		aElem->cVar[MX]  += dt * aElem->u_t[MX];
-		aElem->cVar[MY]  += dt * aElem->u_t[MY];
-		aElem->cVar[E]   += dt * aElem->u_t[E];
+		cVar[RHO] += dt * u_t[RHO];
+		cVar[MX]  += dt * u_t[MX];
+		cVar[MY]  += dt * u_t[MY];
+		cVar[E]   += dt * u_t[E];
 
-		consPrim(aElem->cVar, aElem->pVar);
+		consPrim(cVar, elemData.pVar[iElem]);
 	}
 
 	globalResidual(resIter);
 }
 
 /**
- * \brief Performs explicit time step using Runge-Kutta scheme `nRKstages` stages
+ * \brief Performs explicit time step using Runge-Kutta scheme `nRKstages` stages,
+ *	with the time step of each element
  * \param[in] time Computation time at calculation
- * \param[in] dt Time step at calculation
+ * \param[in] dt Global time step, for the stage times
  * \param[out] resIter Residual vector for time step
  */
 void explicitTimeStepRK(double time, double dt, double resIter[NVAR + 2])
 {
 	/* save the initial solution as needed for the RK scheme */
-	#pragma omp parallel for
-	for (long iElem = 0; iElem < nElems; ++iElem) {
-		elem_t *aElem = elem[iElem];
-		aElem->cVarStage[RHO] = aElem->cVar[RHO];
-		aElem->cVarStage[MX]  = aElem->cVar[MX];
-		aElem->cVarStage[MY]  = aElem->cVar[MY];
-		aElem->cVarStage[E]   = aElem->cVar[E];
-	}
+	memcpy(elemData.cVarStage, elemData.cVar, nElems * sizeof(double[NVAR]));
 
 	/* loop over the RK stages */
 	for (int iStage = 1; iStage <= nRKstages; ++iStage) {
 		double dtStage = RKcoeff[iStage - 1] * dt;
 		fvTimeDerivative(time + dtStage);
+		double (*u_tUpdate)[NVAR] = elemData.u_t;
+		if (residualSmoothing > 0.0) {
+			smoothTimeDerivative();
+			u_tUpdate = u_tSmooth;
+		}
 
 		/* time update of conservative variables */
 		#pragma omp parallel for
 		for (long iElem = 0; iElem < nElems; ++iElem) {
-			elem_t *aElem = elem[iElem];
+			double dtRK = RKcoeff[iStage] * elemData.dt[iElem];
+			double *cVar = elemData.cVar[iElem];
+			double *cVarStage = elemData.cVarStage[iElem];
+			double *u_t = u_tUpdate[iElem];
 
-			aElem->cVar[RHO] = aElem->cVarStage[RHO]
-				+ RKcoeff[iStage] * dt * aElem->u_t[RHO];
+			cVar[RHO] = cVarStage[RHO] + dtRK * u_t[RHO];
+			cVar[MX]  = cVarStage[MX]  + dtRK * u_t[MX];
+			cVar[MY]  = cVarStage[MY]  + dtRK * u_t[MY];
+			cVar[E]   = cVarStage[E]   + dtRK * u_t[E];
 
-			aElem->cVar[MX]  = aElem->cVarStage[MX]
-				+ RKcoeff[iStage] * dt * aElem->u_t[MX];
+			consPrim(cVar, elemData.pVar[iElem]);
+		}
+	}
 
-			aElem->cVar[MY]  = aElem->cVarStage[MY]
-				+ RKcoeff[iStage] * dt * aElem->u_t[MY];
+	globalResidual(resIter);
+}
 
-			aElem->cVar[E]   = aElem->cVarStage[E]
-				+ RKcoeff[iStage] * dt * aElem->u_t[E];
+/**
+ * \brief Performs explicit time step using a low-storage Runge-Kutta scheme,
+ *	with the time step of each element
+ *
+ * The solution is updated in place, `elemData.cVarStage` is the register of
+ * the 2N form. As the first stage has a = 0, the register of the last time
+ * step is discarded.
+ *
+ * \param[in] time Computation time at calculation
+ * \param[in] dt Global time step, for the stage times
+ * \param[out] resIter Residual vector for time step
+ */
+void explicitTimeStepLowStorageRK(double time, double dt, double resIter[NVAR + 2])
+{
+	double (*dU)[NVAR] = elemData.cVarStage;
 
-			consPrim(aElem->cVar, aElem->pVar);
+	for (int iStage = 1; iStage <= nRKstages; ++iStage) {
+		fvTimeDerivative(time + RKc[iStage] * dt);
+		double (*u_tUpdate)[NVAR] = elemData.u_t;
+		if (residualSmoothing > 0.0) {
+			smoothTimeDerivative();
+			u_tUpdate = u_tSmooth;
+		}
+
+		double a = RKa[iStage];
+		double b = RKb[iStage];
+
+		#pragma omp parallel for
+		for (long iElem = 0; iElem < nElems; ++iElem) {
+			double dtElem = elemData.dt[iElem];
+			double *cVar = elemData.cVar[iElem];
+			double *reg = dU[iElem];
+			double *u_t = u_tUpdate[iElem];
+
+			reg[RHO] = a * reg[RHO] + dtElem * u_t[RHO];
+			reg[MX]  = a * reg[MX]  + dtElem * u_t[MX];
+			reg[MY]  = a * reg[MY]  + dtElem * u_t[MY];
+			reg[E]   = a * reg[E]   + dtElem * u_t[E];
+
+			cVar[RHO] += b * reg[RHO];
+			cVar[MX]  += b * reg[MX];
+			cVar[MY]  += b * reg[MY];
+			cVar[E]   += b * reg[E];
+
+			consPrim(cVar, elemData.pVar[iElem]);
+		}
+	}
+
+	globalResidual(resIter);
+}
+
+/**
+ * \brief Set the state of a stage of the embedded Runge-Kutta pair
+ *
+ * \param[in] iStage Stage of the embedded pair
+ * \param[in] dt Time step
+ */
+void setEmbeddedStage(int iStage, double dt)
+{
+	#pragma omp parallel for
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		double *cVar = elemData.cVar[iElem];
+		double *cVarStage = elemData.cVarStage[iElem];
+
+		for (int iVar = 0; iVar < NVAR; ++iVar) {
+			double sum = 0.0;
+			for (int jStage = 0; jStage < iStage; ++jStage) {
+				sum += ERKa[iStage][jStage] * ERKk[jStage][iElem][iVar];
+			}
+			cVar[iVar] = cVarStage[iVar] + dt * sum;
+		}
+
+		consPrim(cVar, elemData.pVar[iElem]);
+	}
+}
+
+/**
+ * \brief Estimate the temporal error of the embedded Runge-Kutta pair
+ *
+ * The error is the root mean square over all elements and variables of the
+ * difference of both solutions, scaled with errorTolerance * (1 + |U|).
+ * A time step with an error up to 1 is accepted.
+ *
+ * \param[in] dt Time step
+ * \return scaled error estimate
+ */
+double embeddedError(double dt)
+{
+	double sumErr = 0.0;
+
+	#pragma omp parallel for reduction(+:sumErr)
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		double *cVar = elemData.cVar[iElem];
+		double *cVarStage = elemData.cVarStage[iElem];
+
+		for (int iVar = 0; iVar < NVAR; ++iVar) {
+			double est = 0.0;
+			for (int iStage = 0; iStage < nERKstages; ++iStage) {
+				est += ERKe[iStage] * ERKk[iStage][iElem][iVar];
+			}
+
+			double scale = errorTolerance
+				* (1.0 + fmax(fabs(cVar[iVar]), fabs(cVarStage[iVar])));
+			double ratio = dt * est / scale;
+			sumErr += ratio * ratio;
+		}
+	}
+
+	return sqrt(sumErr / (nElems * NVAR));
+}
+
+/**
+ * \brief Performs explicit time step using an embedded Runge-Kutta pair
+ *	with error control
+ *
+ * The time step is the minimum of the CFL time step and the time step of
+ * the controller. Steps with a too large error are rejected and repeated
+ * with a smaller time step. The controller proposes the next time step as
+ *	dt * safety * err^(-alpha/k) * errOld^(beta/k),
+ * with k the order of the embedded solution plus one.
+ *
+ * \param[in] time Computation time at calculation
+ * \param[in,out] dt CFL time step on input, time step taken on output
+ * \param[out] resIter Residual vector for time step
+ */
+void explicitTimeStepEmbeddedRK(double time, double *dt, double resIter[NVAR + 2])
+{
+	double dtStep = *dt;
+	bool isControlled = false;
+
+	/* the CFL time step is already adapted to data output and stop time */
+	if (dtError < *dt) {
+		dtStep = dtError;
+		isControlled = true;
+
+		double tNext = fmin(printTime, stopTime);
+		if (time + 1.5 * dtStep > tNext) {
+			dtStep = 0.5 * (tNext - time);
+			isControlled = false;
 		}
 	}
 
+	memcpy(elemData.cVarStage, elemData.cVar, nElems * sizeof(double[NVAR]));
+
+	if (!isFSALvalid) {
+		fvTimeDerivative(time);
+		memcpy(ERKk[0], elemData.u_t, nElems * sizeof(double[NVAR]));
+		isFSALvalid = true;
+	}
+
+	bool isRejected = false;
+	double err;
+	while (true) {
+		for (int iStage = 1; iStage < nERKstages; ++iStage) {
+			setEmbeddedStage(iStage, dtStep);
+			fvTimeDerivative(time + ERKc[iStage] * dtStep);
+			memcpy(ERKk[iStage], elemData.u_t, nElems * sizeof(double[NVAR]));
+		}
+
+		err = embeddedError(dtStep);
+		if (err <= 1.0) {
+			break;
+		}
+
+		/* reject the time step, a non-finite error gives the minimum factor */
+		nRejectedSteps++;
+		isRejected = isControlled = true;
+		dtStep *= fmax(ERK_MIN_FACTOR, ERK_SAFETY * pow(err, - 1.0 / errorOrder));
+		if (dtStep < 1e-14 * fmax(1.0, fabs(time))) {
+			printf("| ERROR: Time Step of the Error Control Vanishes\n");
+			exit(1);
+		}
+
+		setEmbeddedStage(0, dtStep);
+	}
+
+	/* PI controller, the time step may not grow after a rejection */
+	if (isControlled) {
+		double factor = ERK_SAFETY * pow(err, - ERK_ALPHA / errorOrder)
+			* pow(errorOld, ERK_BETA / errorOrder);
+		factor = fmin(ERK_MAX_FACTOR, fmax(ERK_MIN_FACTOR, factor));
+		if (isRejected) {
+			factor = fmin(factor, 1.0);
+		}
+		dtError = factor * dtStep;
+	}
+	errorOld = fmax(err, 1e-4);
+
+	/* the last stage is the first stage of the next time step */
+	double (*k)[NVAR] = ERKk[0];
+	ERKk[0] = ERKk[nERKstages - 1];
+	ERKk[nERKstages - 1] = k;
+
+	*dt = dtStep;
 	globalResidual(resIter);
 }
 
+/**
+ * \brief Reduce the time step after the Newton method did not converge
+ * \param[in,out] dt Global time step
+ */
+void cutBackTimeStep(double *dt)
+{
+	nCutbacks++;
+	if (nCutbacks > MAX_CUTBACKS) {
+		printf("| ERROR: Newton not converged after %d reductions of the time step\n",
+				MAX_CUTBACKS);
+		exit(1);
+	}
+
+	cfl *= CFL_CUTBACK;
+	*dt *= CFL_CUTBACK;
+
+	#pragma omp parallel for
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		elemData.dt[iElem] *= CFL_CUTBACK;
+	}
+
+	printf("| Time Step Reduced: CFL %g\n", cfl);
+}
+
+/**
+ * \brief Adapt the CFL number of an implicit computation after a converged
+ *	time step
+ *
+ * With `cflMax`, stationary computations use switched evolution relaxation
+ * (SER): the CFL number grows with the ratio of the residuals of the last two
+ * time steps, by at most `SER_MAX_GROWTH` per time step, up to `cflMax`.
+ * A rising residual reduces the CFL number at most down to the CFL number of
+ * the parameter file, or down to the current CFL number after a reduction
+ * by a failed time step, so that it cannot decay towards zero.
+ * Otherwise a reduced CFL number grows back to the CFL number of the
+ * parameter file.
+ *
+ * \param[in] residual Residual of the time step
+ */
+void updateCFL(double residual)
+{
+	nCutbacks = 0;
+
+	if (cflMax > cflInit) {
+		if (resSER > 0.0) {
+			double cflLow = fmin(cfl, cflInit);
+			cfl = fmax(cflLow, fmin(cflMax,
+					cfl * fmin(SER_MAX_GROWTH, resSER / residual)));
+		}
+		resSER = residual;
+	} else {
+		cfl = fmin(cflInit, cfl * SER_MAX_GROWTH);
+	}
+}
+
+/**
+ * \brief Set the state of the Newton iteration to the last Newton iterate
+ *	plus the scaled update
+ * \param[in] lambda Scaling of the update
+ * \return True if the density and pressure stay positive in all elements
+ */
+bool setNewtonState(double lambda)
+{
+	bool isPhysical = true;
+
+	#pragma omp parallel for reduction(&&:isPhysical)
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		elem_t *aElem = elem[iElem];
+
+		aElem->cVar[RHO] = XK[RHO][iElem] + lambda * deltaX[RHO][iElem];
+		aElem->cVar[MX]  = XK[MX][iElem]  + lambda * deltaX[MX][iElem];
+		aElem->cVar[MY]  = XK[MY][iElem]  + lambda * deltaX[MY][iElem];
+		aElem->cVar[E]   = XK[E][iElem]   + lambda * deltaX[E][iElem];
+
+		consPrim(aElem->cVar, aElem->pVar);
+
+		isPhysical = isPhysical && (aElem->pVar[RHO] > 0.0)
+			&& (aElem->pVar[P] > 0.0);
+	}
+
+	return isPhysical;
+}
+
+/**
+ * \brief Compute the residual of the implicit system for the current state
+ * \param[in] time Computation time at calculation
+ * \param[in] alpha Relaxation parameter
+ * \return The squared norm of the residual
+ */
+double newtonResidual(double time, double alpha)
+{
+	fvTimeDerivative(time);
+
+	#pragma omp parallel for
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		elem_t *aElem = elem[iElem];
+
+		R_XK[RHO][iElem] = aElem->u_t[RHO];
+		R_XK[MX][iElem]  = aElem->u_t[MX];
+		R_XK[MY][iElem]  = aElem->u_t[MY];
+		R_XK[E][iElem]   = aElem->u_t[E];
+
+		F_XK[RHO][iElem] = aElem->cVar[RHO] - Q[RHO][iElem] - alpha * elemData.dt[iElem] * aElem->u_t[RHO];
+		F_XK[MX][iElem]  = aElem->cVar[MX]  - Q[MX][iElem]  - alpha * elemData.dt[iElem] * aElem->u_t[MX];
+		F_XK[MY][iElem]  = aElem->cVar[MY]  - Q[MY][iElem]  - alpha * elemData.dt[iElem] * aElem->u_t[MY];
+		F_XK[E][iElem]   = aElem->cVar[E]   - Q[E][iElem]   - alpha * elemData.dt[iElem] * aElem->u_t[E];
+	}
+
+	return vectorDotProduct(F_XK, F_XK);
+}
+
+/**
+ * \brief Backtracking line search along the Newton update
+ *
+ * The update is scaled down so that the density and pressure change by no
+ * more than `maxUpdate` relative to their values in any element, and it is
+ * halved until the state is physical and the residual of the implicit system
+ * decreases.
+ *
+ * \param[in] time Computation time at calculation
+ * \param[in] alpha Relaxation parameter
+ * \param[in,out] norm2_F_XK Squared norm of the residual of the last and the
+ *	new Newton iterate
+ * \return True if an acceptable step was found
+ */
+bool lineSearch(double time, double alpha, double *norm2_F_XK)
+{
+	/* limit the relative change of density and pressure */
+	double maxChange = 0.0;
+
+	#pragma omp parallel for reduction(max:maxChange)
+	for (long iElem = 0; iElem < nElems; ++iElem) {
+		double *pVar = elem[iElem]->pVar;
+		double rho = XK[RHO][iElem] + deltaX[RHO][iElem];
+		double mx = XK[MX][iElem] + deltaX[MX][iElem];
+		double my = XK[MY][iElem] + deltaX[MY][iElem];
+		double p = gam1 * (XK[E][iElem] + deltaX[E][iElem]
+				- 0.5 * (mx * mx + my * my) / rho);
+
+		maxChange = fmax(maxChange, fabs(rho - pVar[RHO]) / pVar[RHO]);
+		maxChange = fmax(maxChange, fabs(p - pVar[P]) / pVar[P]);
+	}
+
+	double lambda = 1.0;
+	if (!(maxChange <= maxUpdate)) {
+		lambda = (isfinite(maxChange) ? maxUpdate / maxChange : 0.5);
+	}
+
+	for (int iStep = 0; iStep < LINE_SEARCH_STEPS; ++iStep) {
+		if (setNewtonState(lambda)) {
+			double norm2 = newtonResidual(time, alpha);
+			if (norm2 < *norm2_F_XK) {
+				*norm2_F_XK = norm2;
+				return true;
+			}
+		}
+		lambda *= 0.5;
+	}
+
+	return false;
+}
+
 /** \brief Euler implicit time integration
  *
  * The non-linear equations require the use of a Newton method with internal
- * sub-iteration, using a GMRES method.
+ * sub-iteration, using a GMRES method. If the Newton method does not
+ * converge, the state of the last time step is restored.
  *
  * \param[in] time Computation time at calculation
- * \param[in] dt Time step at calculation
+ * \param[in] dt Global time step, the elements use their own time step
  * \param[out] resIter Residual vector for time step
+ * \return True if the Newton method converged
  */
-void implicitTimeStep(double time, double dt, double resIter[NVAR + 2])
+bool implicitTimeStep(double time, double dt, double resIter[NVAR + 2])
 {
 	/* input parameters for Newton */
 	double alpha = 1.0;
@@ -437,16 +1146,16 @@ void implicitTimeStep(double time, double dt, double resIter[NVAR + 2])
 		elem_t *aElem = elem[iElem];
 
 		F_X0[RHO][iElem] = aElem->cVar[RHO] - Q[RHO][iElem]
-			- alpha * dt * aElem->u_t[RHO];
+			- alpha * elemData.dt[iElem] * aElem->u_t[RHO];
 
 		F_X0[MX][iElem]  = aElem->cVar[MX]  - Q[MX][iElem]
-			- alpha * dt * aElem->u_t[MX];
+			- alpha * elemData.dt[iElem] * aElem->u_t[MX];
 
 		F_X0[MY][iElem]  = aElem->cVar[MY]  - Q[MY][iElem]
-			- alpha * dt * aElem->u_t[MY];
+			- alpha * elemData.dt[iElem] * aElem->u_t[MY];
 
 		F_X0[E][iElem]   = aElem->cVar[E]   - Q[E][iElem]
-			- alpha * dt * aElem->u_t[E];
+			- alpha * elemData.dt[iElem] * aElem->u_t[E];
 
 		XK[RHO][iElem] = aElem->cVar[RHO];
 		XK[MX][iElem]  = aElem->cVar[MX];
@@ -476,6 +1185,7 @@ void implicitTimeStep(double time, double dt, double resIter[NVAR + 2])
 	nInnerNewton = 0;
 
 	/* Newton iterations */
+	bool hasFailed = false;
 	double abortCritGMRES, norm2_F_XK_old = norm2_F_XK, gamA, gamB;
 	while ((norm2_F_XK > eps2newtonLoc * norm2_F_X0) && (nInnerNewton < nNewtonIter)) {
 		if (nInnerNewton == 0) {
@@ -499,56 +1209,60 @@ void implicitTimeStep(double time, double dt, double resIter[NVAR + 2])
 
 		nInnerNewton++;
 
-		GMRES_M(time, dt, alpha, F_XK, sqrt(norm2_F_XK),
-				&abortCritGMRES, deltaX);
+		if (!GMRES_M(time, alpha, F_XK, sqrt(norm2_F_XK),
+				&abortCritGMRES, deltaX)) {
+			hasFailed = true;
+			break;
+		}
+
+		if (isLineSearch) {
+			if (!lineSearch(time, alpha, &norm2_F_XK)) {
+				hasFailed = true;
+				break;
+			}
+		} else {
+			setNewtonState(1.0);
+			norm2_F_XK = newtonResidual(time, alpha);
+		}
 
 		#pragma omp parallel for
 		for (long iElem = 0; iElem < nElems; ++iElem) {
 			elem_t *aElem = elem[iElem];
 
-			XK[RHO][iElem] += deltaX[RHO][iElem];
-			XK[MX][iElem]  += deltaX[MX][iElem];
-			XK[MY][iElem]  += deltaX[MY][iElem];
-			XK[E][iElem]   += deltaX[E][iElem];
-
-			aElem->cVar[RHO] = XK[RHO][iElem];
-			aElem->cVar[MX]  = XK[MX][iElem];
-			aElem->cVar[MY]  = XK[MY][iElem];
-			aElem->cVar[E]   = XK[E][iElem];
-
-			consPrim(aElem->cVar, aElem->pVar);
+			XK[RHO][iElem] = aElem->cVar[RHO];
+			XK[MX][iElem]  = aElem->cVar[MX];
+			XK[MY][iElem]  = aElem->cVar[MY];
+			XK[E][iElem]   = aElem->cVar[E];
 		}
+	}
 
-		fvTimeDerivative(time);
+	nNewtonIterGlobal += nInnerNewton;
 
+	if ((nInnerNewton == nNewtonIter) && (norm2_F_XK > eps2newtonLoc * norm2_F_X0)) {
+		hasFailed = true;
+	}
+	if (hasFailed || !isfinite(norm2_F_XK)) {
+		printf("| Newton NOT converged with %d Newton iterations\n", nInnerNewton);
+		printf("| Norm / Norm_R0 = %g\n", norm2_F_XK / norm2_F_X0);
+
+		/* restore the state of the last time step */
 		#pragma omp parallel for
 		for (long iElem = 0; iElem < nElems; ++iElem) {
 			elem_t *aElem = elem[iElem];
 
-			R_XK[RHO][iElem] = aElem->u_t[RHO];
-			R_XK[MX][iElem]  = aElem->u_t[MX];
-			R_XK[MY][iElem]  = aElem->u_t[MY];
-			R_XK[E][iElem]   = aElem->u_t[E];
+			aElem->cVar[RHO] = Q[RHO][iElem];
+			aElem->cVar[MX]  = Q[MX][iElem];
+			aElem->cVar[MY]  = Q[MY][iElem];
+			aElem->cVar[E]   = Q[E][iElem];
 
-			F_XK[RHO][iElem] = aElem->cVar[RHO] - Q[RHO][iElem] - alpha * dt * aElem->u_t[RHO];
-			F_XK[MX][iElem]  = aElem->cVar[MX]  - Q[MX][iElem]  - alpha * dt * aElem->u_t[MX];
-			F_XK[MY][iElem]  = aElem->cVar[MY]  - Q[MY][iElem]  - alpha * dt * aElem->u_t[MY];
-			F_XK[E][iElem]   = aElem->cVar[E]   - Q[E][iElem]   - alpha * dt * aElem->u_t[E];
+			consPrim(aElem->cVar, aElem->pVar);
 		}
 
-		norm2_F_XK = vectorDotProduct(F_XK, F_XK);
-	}
-
-	nNewtonIterGlobal += nInnerNewton;
-
-	if (nInnerNewton == nNewtonIter) {
-		printf("| %g\n", eps2newton);
-		printf("| Newton NOT converged with %d Newton iteraions\n", nInnerNewton);
-		printf("| Norm / Norm_R0 = %g\n", norm2_F_XK / norm2_F_X0);
-		exit(1);
+		return false;
 	}
 
 	globalResidual(resIter);
+	return true;
 }
 
 /** \brief Main time discretization loop
@@ -598,18 +1312,30 @@ void timeDisc(void)
 		/* main computation loop */
 		double resIter[NVAR + 2] = {0.0};
 		if (!isImplicit) {
-			if ((timeOrder == 1) && (nRKstages == 1)) {
-				explicitTimeStepEuler(t, dt, resIter);
+			if (embeddedRK > 0) {
+				explicitTimeStepEmbeddedRK(t, &dt, resIter);
+			} else if (isLowStorageRK) {
+				explicitTimeStepLowStorageRK(t, dt, resIter);
+			} else if ((timeOrder == 1) && (nRKstages == 1)) {
+				explicitTimeStepEuler(t, resIter);
 			} else {
 				explicitTimeStepRK(t, dt, resIter);
 			}
 		} else {
-			implicitTimeStep(t, dt, resIter);
+			while (!implicitTimeStep(t, dt, resIter)) {
+				cutBackTimeStep(&dt);
+			}
+			updateCFL(resIter[abortVariable]);
+		}
+
+		/* coarse grid correction */
+		if (nMGlevels > 1) {
+			multigridCorrection(t);
 		}
 		t += dt;
 
 		/* analyze results */
-		analyze(t, iter, resIter);
+		analyze(t, dt, iter, resIter);
 
 		/* end time abort criterion */
 		if (stopTime - t <= 1e-15) {
@@ -628,6 +1354,11 @@ void timeDisc(void)
 			break;
 		}
 
+		/* freeze the limiter once the residual has dropped */
+		if (isStationary) {
+			checkLimiterFreeze(t, iter, resIter[abortVariable]);
+		}
+
 		/* residual abort criterion */
 		if (isStationary) {
 			if (fabs(resIter[abortVariable]) <= abortResidual) {
@@ -705,6 +1436,10 @@ void timeDisc(void)
 					printf("|            MY : %20.14e\n", resIter[MY]);
 					printf("|            E  : %20.14e\n", resIter[E]);
 				}
+
+				if (isImplicit && (cflMax > cflInit)) {
+					printf("| CFL: %g\n", cfl);
+				}
 			} else {
 				printf("| Time     : %.10g\n", t);
 				calcTimeStep(printTime + 1e150, &dt, &viscousTimeStepDominates);
@@ -754,6 +1489,13 @@ void timeDisc(void)
 	if (isImplicit) {
 		printf("| Newton Iterations: %d\n", nNewtonIterGlobal);
 		printf("| GMRES Iterations : %d\n", nGMRESiterGlobal);
+		printf("| GMRES Failures   : %d\n", nGMRESfailGlobal);
+	}
+	if (nMGlevels > 1) {
+		printf("| Multigrid Work   : %.10g Residuals\n", mgWork);
+	}
+	if (embeddedRK > 0) {
+		printf("| Rejected Steps   : %ld\n", nRejectedSteps);
 	}
 
 	/* close all open files */
@@ -774,4 +1516,15 @@ void timeDisc(void)
 		free(F_X0);
 		free(F_XK);
 	}
+
+	if (residualSmoothing > 0.0) {
+		free(u_tSmooth);
+		free(u_tSweep);
+	}
+
+	if (embeddedRK > 0) {
+		for (int iStage = 0; iStage < nERKstages; ++iStage) {
+			free(ERKk[iStage]);
+		}
+	}
 }
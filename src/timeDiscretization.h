@@ -32,6 +32,7 @@ extern int	timeOrder;
 extern bool	isTimeStep1D;
 
 extern bool	isStationary;
+extern bool	isLocalTimeStep;
 extern long	maxIter;
 extern double	stopTime;
 extern long	iniIterationNumber;
@@ -51,6 +52,7 @@ extern double	printTime;
 
 extern int	nRKstages;
 extern double	RKcoeff[6];
+extern bool	isLowStorageRK;
 extern bool	isImplicit;
 
 void initTimeDisc(void);